@@ -0,0 +1,90 @@
+#pragma once
+
+#include <limits>
+
+#include "GraphTraits.hpp"
+#include "Types.hpp"
+#include "Intern/Algorithms.hpp"
+#include "Intern/Enumeration.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Enumerate all node sets that form connected subgraphs with a chosen algorithm
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param algorithm The enumeration algorithm. See \ref ConsensLib::EnumerationAlgorithm.
+ *                  By default it is chosen by \ref ConsensLib::selectEnumerationAlgorithm.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the subgraphs.
+ *               Must accept std::vector<Node> as input and return a boolean.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ *
+ * The result contains the same node sets as \ref ConsensLib::runConsens, each sorted with respect
+ * to 'compare'. Only \ref ConsensLib::EnumerationAlgorithm::CONSENS generates them in the same
+ * order; all other algorithms copy the graph once into an internal index graph.
+ */
+template<typename Graph,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename FilterFunc = NoFilter,
+         typename Compare = std::less<Node>>
+std::vector<std::vector<Node>> runConsensAlgorithm(
+    const Graph& graph,
+    EnumerationAlgorithm algorithm = EnumerationAlgorithm::AUTO,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare())
+{
+  Intern::SubgraphCollector<Node> collector;
+  Intern::visitAlgorithmEnumeration<Graph, Node>(graph, algorithm, upper, filter, collector, compare);
+  return std::move(collector.subgraphs);
+}
+
+/**
+ * @brief Enumerate all node sets that form connected subgraphs with a chosen algorithm
+ *        and report the enumeration to a visitor
+ *
+ * Same parameters as \ref ConsensLib::runConsensAlgorithm with the visitor of \ref ConsensLib::runConsensVisitor.
+ * Every algorithm asks 'expand' before enumerating the super graphs of a subgraph, passing the nodes it may
+ * add next. Which super graphs are pruned depends on the recursion of the algorithm, so a visitor should only
+ * prune subgraphs none of whose super graphs are wanted if the result must not depend on the algorithm.
+ */
+template<typename Graph,
+         typename Visitor,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename FilterFunc = NoFilter,
+         typename Compare = std::less<Node>>
+void runConsensAlgorithmVisitor(
+    const Graph& graph,
+    Visitor& visitor,
+    EnumerationAlgorithm algorithm = EnumerationAlgorithm::AUTO,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare())
+{
+  Intern::visitAlgorithmEnumeration<Graph, Node>(graph, algorithm, upper, filter, visitor, compare);
+}
+
+/**
+ * @brief Choose the enumeration algorithm that \ref ConsensLib::EnumerationAlgorithm::AUTO uses for a graph
+ *
+ * @param graph Input graph
+ * @param upper Optional upper bound for the size of the subgraphs.
+ *
+ * The choice only depends on the number of nodes and edges, the maximum degree and the upper bound,
+ * which are computed in a single pass over the adjacency lists.
+ */
+template<typename Graph>
+EnumerationAlgorithm selectEnumerationAlgorithm(
+    const Graph& graph,
+    size_t upper = std::numeric_limits<size_t>::max())
+{
+  return Intern::selectAlgorithm(graph, upper);
+}
+} // end namespace ConsensLib
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "CsrGraph.hpp"
+#include "GraphTraits.hpp"
+#include "Types.hpp"
+#include "Intern/Cache.hpp"
+#include "Intern/Canonical.hpp"
+#include "Intern/Enumeration.hpp"
+#include "Intern/IndexGraph.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Counters describing the use of an \ref ConsensLib::EnumerationCache.
+ */
+struct CacheStatistics
+{
+  size_t hits = 0;      ///< enumerations answered from the cache
+  size_t misses = 0;    ///< enumerations performed because the graph was not cached
+  size_t evictions = 0; ///< entries removed to respect the memory bound
+  size_t entries = 0;   ///< entries currently stored
+  size_t bytes = 0;     ///< memory currently used by the stored entries
+};
+
+/**
+ * @brief Cache of enumeration results keyed by the isomorphism class of the graph.
+ *
+ * Stores the subgraphs of canonically labeled graphs, so every graph isomorphic to a cached one
+ * is answered by relabeling the stored subgraphs. The least recently used entries are evicted
+ * as soon as the stored entries exceed the memory bound; entries larger than the bound are not
+ * stored at all. The cache is not thread-safe. See \ref ConsensLib::runConsensCached.
+ */
+class EnumerationCache
+{
+public:
+
+  explicit EnumerationCache(size_t maxBytes = size_t(256) << 20)
+    : m_maxBytes(maxBytes) {}
+
+  EnumerationCache(const EnumerationCache&) = delete;
+  EnumerationCache& operator=(const EnumerationCache&) = delete;
+
+  const CacheStatistics& statistics() const
+  {
+    return m_statistics;
+  }
+
+  size_t maxBytes() const
+  {
+    return m_maxBytes;
+  }
+
+  /**
+   * @brief Remove all entries. The counters of hits, misses and evictions are kept.
+   */
+  void clear()
+  {
+    m_entries.clear();
+    m_index.clear();
+    m_statistics.entries = 0;
+    m_statistics.bytes = 0;
+  }
+
+  /**
+   * @brief Return the subgraphs stored for 'key' or compute them with 'enumerate' and store them.
+   *
+   * The returned subgraphs stay valid even if the entry is evicted in the meantime.
+   */
+  template<typename Enumerate>
+  std::shared_ptr<const Intern::CachedSubgraphs> findOrInsert(
+      Intern::CacheKey key,
+      const Enumerate& enumerate)
+  {
+    auto foundIter = m_index.find(key);
+    if (foundIter != m_index.end()) {
+      ++m_statistics.hits;
+      m_entries.splice(m_entries.begin(), m_entries, foundIter->second);
+      return foundIter->second->subgraphs;
+    }
+    ++m_statistics.misses;
+    auto subgraphs = std::make_shared<const Intern::CachedSubgraphs>(enumerate());
+    size_t bytes = subgraphs->bytes() + 2 * key.certificate.size() * sizeof(uint32_t);
+    if (bytes > m_maxBytes) {
+      return subgraphs;
+    }
+    while (m_statistics.bytes + bytes > m_maxBytes) {
+      m_statistics.bytes -= m_entries.back().bytes;
+      m_index.erase(m_entries.back().key);
+      m_entries.pop_back();
+      --m_statistics.entries;
+      ++m_statistics.evictions;
+    }
+    m_entries.push_front(Entry{key, subgraphs, bytes});
+    m_index.emplace(std::move(key), m_entries.begin());
+    ++m_statistics.entries;
+    m_statistics.bytes += bytes;
+    return subgraphs;
+  }
+
+private:
+
+  struct Entry
+  {
+    Intern::CacheKey key;
+    std::shared_ptr<const Intern::CachedSubgraphs> subgraphs;
+    size_t bytes;
+  };
+
+  size_t m_maxBytes;
+  std::list<Entry> m_entries;
+  std::unordered_map<Intern::CacheKey, std::list<Entry>::iterator, Intern::CacheKeyHash> m_index;
+  CacheStatistics m_statistics;
+};
+
+/**
+ * @brief Perform the CONSENS algorithm with the results of isomorphic graphs shared through a cache
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param cache Cache shared by the queries. See \ref ConsensLib::EnumerationCache.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the subgraphs.
+ *               Must accept std::vector<Node> as input and return a boolean.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ *
+ * Computes a canonical labeling of the graph by individualization-refinement. If the canonical
+ * graph is cached, its subgraphs are relabeled to the nodes of 'graph'; otherwise they are
+ * enumerated on the canonical graph and stored. The filter is applied after relabeling, so it
+ * may depend on node attributes that the canonical form ignores. The result contains the same
+ * node sets as \ref ConsensLib::runConsens, each sorted with respect to 'compare', in the order
+ * of the enumeration on the canonical graph.
+ */
+template<typename Graph,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename FilterFunc = NoFilter,
+         typename Compare = std::less<Node>>
+std::vector<std::vector<Node>> runConsensCached(
+    const Graph& graph,
+    EnumerationCache& cache,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare())
+{
+  Intern::IndexGraph<Node> indexGraph = Intern::buildIndexGraph<Graph, Node>(graph, compare);
+  Intern::CanonicalLabeling canonical = Intern::canonicalLabeling(indexGraph.graph);
+  size_t nofNodes = indexGraph.nodes.size();
+  Intern::CacheKey key{std::min(upper, nofNodes), std::move(canonical.certificate)};
+  std::shared_ptr<const Intern::CachedSubgraphs> subgraphs = cache.findOrInsert(std::move(key), [&]() {
+    CsrGraph<uint32_t> canonicalGraph = indexGraph.graph.permuted(canonical.labels);
+    Intern::CachedSubgraphsCollector collector;
+    Intern::visitEnumeration<CsrGraph<uint32_t>, uint32_t>(canonicalGraph, upper, NoFilter(), collector,
+                                                          std::less<uint32_t>());
+    return std::move(collector.subgraphs);
+  });
+
+  std::vector<Node> labeledNodes(nofNodes);
+  for (size_t idx = 0; idx < nofNodes; ++idx) {
+    labeledNodes[canonical.labels[idx]] = indexGraph.nodes[idx];
+  }
+  std::vector<std::vector<Node>> result;
+  std::vector<Node> mapped;
+  size_t begin = 0;
+  for (size_t end : subgraphs->ends) {
+    mapped.clear();
+    for (size_t pos = begin; pos < end; ++pos) {
+      mapped.push_back(labeledNodes[subgraphs->nodes[pos]]);
+    }
+    std::sort(mapped.begin(), mapped.end(), compare);
+    if (filter(mapped)) {
+      result.push_back(mapped);
+    }
+    begin = end;
+  }
+  return result;
+}
+} // end namespace ConsensLib
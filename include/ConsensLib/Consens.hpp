@@ -70,4 +70,45 @@ std::vector<std::vector<Node>> runConsens(
 {
   return Intern::runEnumeration<Graph, Node, FilterFunc, Compare>(graph, upper, filter, compare);
 }
+
+/**
+ * @brief Perform the CONSENS algorithm and report the enumeration as a stream of events
+ *        instead of collecting the node sets
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Visitor Type of visitor receiving the enumeration events.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param visitor Visitor receiving the events. See \ref ConsensLib::EnumerationVisitor.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the subgraphs.
+ *               Must accept std::vector<Node> as input and return a boolean.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ *
+ * The recursion of the CONSENS algorithm adds a single node to the currently considered subgraph
+ * before each recursive call and removes it afterwards. The visitor is notified of every such step
+ * by 'push' and 'pop' and of every subgraph fulfilling the filter criteria by 'emit'.
+ * If 'expand' returns false for a subgraph, none of its super graphs in the recursion are enumerated.
+ * The emitted node set is sorted with respect to 'compare' and only valid during the call.
+ * A visitor maintaining incremental state can follow the enumeration with constant work
+ * per event and therefore constant amortized work per subgraph.
+ */
+template<typename Graph,
+         typename Visitor,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename FilterFunc = NoFilter,
+         typename Compare = std::less<Node>>
+void runConsensVisitor(
+    const Graph& graph,
+    Visitor& visitor,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare())
+{
+  Intern::visitEnumeration<Graph, Node, FilterFunc, Compare, Visitor>(graph, upper, filter, visitor, compare);
+}
 } // end namespace ConsensLib
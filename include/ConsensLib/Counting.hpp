@@ -0,0 +1,48 @@
+#pragma once
+
+#include <limits>
+
+#include "GraphTraits.hpp"
+#include "Intern/Counting.hpp"
+#include "Intern/IndexGraph.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Count the connected induced subgraphs of a given input graph per number of nodes
+ *        without enumerating them
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ * @param maxWidth Maximum width of the tree decomposition for which counting is done
+ *                 by dynamic programming. At most 14 is supported.
+ *
+ * @return The number of connected induced subgraphs for every number of nodes
+ *         from zero up to the minimum of 'upper' and the number of nodes in the graph.
+ *
+ * A tree decomposition of the graph is computed with the minimum degree heuristic.
+ * If its width is at most 'maxWidth' the subgraphs are counted by dynamic programming over
+ * the decomposition. The run-time is linear in the number of nodes and polynomial in 'upper'
+ * for graphs of bounded tree-width such as trees (width one) and most molecular graphs
+ * (width at most three). Otherwise the subgraphs are enumerated and counted, which gives
+ * the same result. The counts are computed modulo 2^64.
+ */
+template<typename Graph,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename Compare = std::less<Node>>
+std::vector<size_t> countConsens(
+    const Graph& graph,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const Compare& compare = Compare(),
+    size_t maxWidth = 6)
+{
+  Intern::IndexGraph<Node> indexGraph = Intern::buildIndexGraph<Graph, Node>(graph, compare);
+  return Intern::countSubgraphs(indexGraph.graph, upper, maxWidth);
+}
+} // end namespace ConsensLib
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "GraphTraits.hpp"
+#include "Intern/CountingIterator.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Compact undirected graph on the nodes 0, ..., n-1 in compressed sparse row format.
+ *
+ * @tparam Index Unsigned integral type of the nodes.
+ *
+ * The adjacency lists of all nodes are stored consecutively and sorted in ascending order,
+ * so the graph can directly be used with the linear time set operations of the enumeration.
+ * The matching \ref ConsensLib::GraphTraits are specified below, including all optional hooks.
+ */
+template<typename Index = uint32_t>
+class CsrGraph {
+
+public:
+
+  using IndexType = Index;
+
+  /**
+   * @brief Construct the empty graph.
+   */
+  CsrGraph()
+    : m_offsets(1, 0) {}
+
+  /**
+   * @brief Construct the graph from a list of undirected edges.
+   *
+   * @param nofNodes Number of nodes in the graph.
+   * @param edges Undirected edges given by the indices of their nodes.
+   *        Duplicate edges and self loops are ignored.
+   */
+  CsrGraph(size_t nofNodes, const std::vector<std::pair<Index, Index>>& edges)
+    : m_offsets(nofNodes + 1, 0)
+  {
+    for (const std::pair<Index, Index>& edge : edges) {
+      if (edge.first != edge.second) {
+        ++m_offsets.at(edge.first + 1);
+        ++m_offsets.at(edge.second + 1);
+      }
+    }
+    for (size_t idx = 0; idx < nofNodes; ++idx) {
+      m_offsets[idx + 1] += m_offsets[idx];
+    }
+    m_neighbors.resize(m_offsets.back());
+    std::vector<size_t> fill(m_offsets.begin(), m_offsets.end() - 1);
+    for (const std::pair<Index, Index>& edge : edges) {
+      if (edge.first != edge.second) {
+        m_neighbors[fill[edge.first]++] = edge.second;
+        m_neighbors[fill[edge.second]++] = edge.first;
+      }
+    }
+    sortAndCompact();
+  }
+
+  /**
+   * @brief Construct the graph from its compressed sparse row representation.
+   *
+   * @param offsets Offsets of the adjacency lists with n+1 entries, the last one being
+   *        the total number of entries in 'neighbors'.
+   * @param neighbors Concatenated adjacency lists. Each adjacency list must be sorted
+   *        and the adjacency must be symmetric.
+   */
+  CsrGraph(std::vector<size_t> offsets, std::vector<Index> neighbors)
+    : m_offsets(std::move(offsets)),
+      m_neighbors(std::move(neighbors))
+  {
+    computeMaxDegree();
+  }
+
+  size_t nofNodes() const
+  {
+    return m_offsets.size() - 1;
+  }
+
+  size_t nofEdges() const
+  {
+    return m_neighbors.size() / 2;
+  }
+
+  size_t degree(Index node) const
+  {
+    return m_offsets[node + 1] - m_offsets[node];
+  }
+
+  size_t maxDegree() const
+  {
+    return m_maxDegree;
+  }
+
+  bool isAdjacent(Index n1, Index n2) const
+  {
+    return std::binary_search(neighborsBegin(n1), neighborsEnd(n1), n2);
+  }
+
+  const Index* neighborsBegin(Index node) const
+  {
+    return m_neighbors.data() + m_offsets[node];
+  }
+
+  const Index* neighborsEnd(Index node) const
+  {
+    return m_neighbors.data() + m_offsets[node + 1];
+  }
+
+  /**
+   * @brief Return a copy of the graph in which every node 'node' is relabeled to 'newIndex[node]'.
+   *
+   * @param newIndex Permutation of the nodes 0, ..., n-1.
+   */
+  CsrGraph permuted(const std::vector<Index>& newIndex) const
+  {
+    size_t nofNodes = this->nofNodes();
+    std::vector<Index> oldIndex(nofNodes);
+    for (size_t idx = 0; idx < nofNodes; ++idx) {
+      oldIndex[newIndex[idx]] = static_cast<Index>(idx);
+    }
+    std::vector<size_t> offsets(nofNodes + 1, 0);
+    std::vector<Index> neighbors;
+    neighbors.reserve(m_neighbors.size());
+    for (size_t idx = 0; idx < nofNodes; ++idx) {
+      Index old = oldIndex[idx];
+      for (const Index* iter = neighborsBegin(old); iter != neighborsEnd(old); ++iter) {
+        neighbors.push_back(newIndex[*iter]);
+      }
+      offsets[idx + 1] = neighbors.size();
+      std::sort(neighbors.begin() + offsets[idx], neighbors.end());
+    }
+    return CsrGraph(std::move(offsets), std::move(neighbors));
+  }
+
+private:
+
+  void sortAndCompact()
+  {
+    size_t write = 0;
+    for (size_t idx = 0; idx + 1 < m_offsets.size(); ++idx) {
+      auto begin = m_neighbors.begin() + m_offsets[idx];
+      auto end = m_neighbors.begin() + m_offsets[idx + 1];
+      std::sort(begin, end);
+      end = std::unique(begin, end);
+      m_offsets[idx] = write;
+      for (auto iter = begin; iter != end; ++iter) {
+        m_neighbors[write++] = *iter;
+      }
+    }
+    m_offsets.back() = write;
+    m_neighbors.resize(write);
+    computeMaxDegree();
+  }
+
+  void computeMaxDegree()
+  {
+    m_maxDegree = 0;
+    for (size_t idx = 0; idx + 1 < m_offsets.size(); ++idx) {
+      m_maxDegree = std::max(m_maxDegree, m_offsets[idx + 1] - m_offsets[idx]);
+    }
+  }
+
+  std::vector<size_t> m_offsets;
+  std::vector<Index> m_neighbors;
+  size_t m_maxDegree = 0;
+};
+
+template<typename Index>
+struct GraphTraits<CsrGraph<Index>> {
+  using Node = Index;
+  using Iterator = const Index*;
+  using NodeIterator = Intern::CountingIterator<Index>;
+
+  static Iterator adjancencyBegin(
+      const Node& node,
+      const CsrGraph<Index>& graph)
+  {
+    return graph.neighborsBegin(node);
+  }
+
+  static Iterator adjancencyEnd(
+      const Node& node,
+      const CsrGraph<Index>& graph)
+  {
+    return graph.neighborsEnd(node);
+  }
+
+  static NodeIterator nodesBegin(const CsrGraph<Index>& graph)
+  {
+    return NodeIterator(0);
+  }
+
+  static NodeIterator nodesEnd(const CsrGraph<Index>& graph)
+  {
+    return NodeIterator(static_cast<Index>(graph.nofNodes()));
+  }
+
+  static constexpr bool listsSorted() {
+    return true;
+  }
+
+  static size_t degree(
+      const Node& node,
+      const CsrGraph<Index>& graph)
+  {
+    return graph.degree(node);
+  }
+
+  static bool isAdjacent(
+      const Node& n1,
+      const Node& n2,
+      const CsrGraph<Index>& graph)
+  {
+    return graph.isAdjacent(n1, n2);
+  }
+
+  static size_t index(
+      const Node& node,
+      const CsrGraph<Index>& graph)
+  {
+    return node;
+  }
+
+  static size_t nodeCount(const CsrGraph<Index>& graph)
+  {
+    return graph.nofNodes();
+  }
+
+  static size_t maxDegree(const CsrGraph<Index>& graph)
+  {
+    return graph.maxDegree();
+  }
+};
+
+} // end namespace ConsensLib
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <limits>
+
+#include "GraphTraits.hpp"
+#include "Intern/Estimation.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Estimate the number of connected induced subgraphs and the run-time of the CONSENS
+ *        algorithm before performing it
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param nofProbes Number of random probes. The run-time of the estimation is proportional to
+ *                  'nofProbes' times the run-time of a single recursive call of the enumeration.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ * @param seed Seed of the random probes.
+ *
+ * @return Estimated counts per number of nodes from zero up to the minimum of 'upper' and the
+ *         number of nodes in the graph with confidence intervals, the estimated run-time and
+ *         the estimated number of subgraphs per root. See \ref ConsensLib::EnumerationEstimate.
+ *
+ * Each probe follows a single random path through the recursion of \ref ConsensLib::runConsens
+ * (Knuth's estimator). The estimates are unbiased, but their variance grows with the imbalance
+ * of the recursion, so the width of the confidence intervals should be taken into account.
+ * The count of the subgraphs owned by each root allows to balance roots across threads or shards.
+ */
+template<typename Graph,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename Compare = std::less<Node>>
+EnumerationEstimate<Node> estimateConsens(
+    const Graph& graph,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    size_t nofProbes = 1000,
+    const Compare& compare = Compare(),
+    unsigned seed = 0)
+{
+  return Intern::estimateEnumeration<Graph, Node>(graph, upper, nofProbes, compare, seed);
+}
+} // end namespace ConsensLib
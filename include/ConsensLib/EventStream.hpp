@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "Types.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Tags of the tokens contained in an encoded event stream.
+ *
+ * Every token is a single unsigned LEB128 varint holding the tag in the two lowest bits
+ * and its value in the remaining bits.
+ */
+enum class EventTag : unsigned char {
+  PUSH = 0,      ///< push of the node given as value
+  PUSH_EMIT = 1, ///< push of the node given as value directly followed by an emit
+  POP = 2,       ///< pop of as many nodes as given by the value
+  EMIT = 3       ///< emit of the current subgraph, the value is zero
+};
+
+/**
+ * @brief Visitor encoding the enumeration events in a compact binary format.
+ *
+ * @tparam Node Type of node contained in the graph. Must be an integral type with non-negative values.
+ *
+ * Nodes are only written when pushed. A pop always removes the most recently pushed node,
+ * so consecutive pops are merged into a single token holding their number. Since every
+ * subgraph is emitted directly after its last node has been pushed, push and emit are merged as well.
+ * Hence most subgraphs take one token of one or two bytes each for their push and pop.
+ *
+ * The stream is complete after \ref finish has been called.
+ */
+template<typename Node>
+class EventStreamEncoder : public EnumerationVisitor
+{
+  static_assert(std::is_integral<Node>::value, "The event stream can only encode integral nodes");
+
+public:
+
+  void push(const Node& node)
+  {
+    flushPending();
+    m_pendingPush = true;
+    m_pendingNode = static_cast<uint64_t>(node);
+  }
+
+  void pop(const Node& node)
+  {
+    if (m_pendingPush) {
+      writeToken(EventTag::PUSH, m_pendingNode);
+      m_pendingPush = false;
+    }
+    ++m_pendingPops;
+  }
+
+  void emit(const std::vector<Node>& subgraph)
+  {
+    if (m_pendingPops != 0) {
+      writeToken(EventTag::POP, m_pendingPops);
+      m_pendingPops = 0;
+    }
+    if (m_pendingPush) {
+      writeToken(EventTag::PUSH_EMIT, m_pendingNode);
+      m_pendingPush = false;
+    }
+    else {
+      writeToken(EventTag::EMIT, 0);
+    }
+  }
+
+  /**
+   * @brief Write all pending events and return the encoded stream.
+   */
+  const std::vector<unsigned char>& finish()
+  {
+    flushPending();
+    return m_data;
+  }
+
+private:
+
+  void flushPending()
+  {
+    if (m_pendingPush) {
+      writeToken(EventTag::PUSH, m_pendingNode);
+      m_pendingPush = false;
+    }
+    if (m_pendingPops != 0) {
+      writeToken(EventTag::POP, m_pendingPops);
+      m_pendingPops = 0;
+    }
+  }
+
+  void writeToken(EventTag tag, uint64_t value)
+  {
+    uint64_t token = (value << 2) | static_cast<uint64_t>(tag);
+    while (token >= 0x80) {
+      m_data.push_back(static_cast<unsigned char>(token | 0x80));
+      token >>= 7;
+    }
+    m_data.push_back(static_cast<unsigned char>(token));
+  }
+
+  std::vector<unsigned char> m_data;
+  bool m_pendingPush = false;
+  uint64_t m_pendingNode = 0;
+  uint64_t m_pendingPops = 0;
+};
+
+/**
+ * @brief Replay an encoded event stream on a visitor.
+ *
+ * @tparam Node Type of node that has been encoded.
+ * @tparam Visitor Type of visitor receiving the events.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param begin Pointer to the first byte of the stream.
+ * @param end Pointer behind the last byte of the stream.
+ * @param visitor Visitor receiving the decoded events.
+ * @param compare Compare function used to keep the emitted subgraphs sorted.
+ *
+ * @return false if the stream is malformed, in which case the replay stops at the malformed token.
+ *
+ * The visitor receives exactly the events of the encoded enumeration. The emitted subgraphs are
+ * sorted with respect to 'compare', so a stream encoded from \ref ConsensLib::runConsensVisitor
+ * and replayed on a collecting visitor reproduces the result of \ref ConsensLib::runConsens.
+ */
+template<typename Node,
+         typename Visitor,
+         typename Compare = std::less<Node>>
+bool decodeEventStream(
+    const unsigned char* begin,
+    const unsigned char* end,
+    Visitor& visitor,
+    const Compare& compare = Compare())
+{
+  std::vector<Node> stack;
+  std::vector<Node> current;
+  auto push = [&](Node node) {
+    stack.push_back(node);
+    current.insert(std::lower_bound(current.begin(), current.end(), node, compare), node);
+    visitor.push(node);
+  };
+  for (const unsigned char* iter = begin; iter != end;) {
+    uint64_t token = 0;
+    unsigned shift = 0;
+    bool complete = false;
+    while (iter != end && shift < 64) {
+      unsigned char byte = *iter++;
+      token |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      shift += 7;
+      if ((byte & 0x80) == 0) {
+        complete = true;
+        break;
+      }
+    }
+    if (!complete) {
+      return false;
+    }
+    uint64_t value = token >> 2;
+    switch (static_cast<EventTag>(token & 3)) {
+    case EventTag::PUSH:
+      push(static_cast<Node>(value));
+      break;
+    case EventTag::PUSH_EMIT:
+      push(static_cast<Node>(value));
+      visitor.emit(current);
+      break;
+    case EventTag::POP:
+      if (value > stack.size()) {
+        return false;
+      }
+      for (uint64_t i = 0; i < value; ++i) {
+        Node node = stack.back();
+        stack.pop_back();
+        current.erase(std::lower_bound(current.begin(), current.end(), node, compare));
+        visitor.pop(node);
+      }
+      break;
+    default:
+      visitor.emit(current);
+    }
+  }
+  return true;
+}
+
+} // end namespace ConsensLib
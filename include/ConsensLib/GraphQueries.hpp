@@ -0,0 +1,56 @@
+#pragma once
+
+#include <functional>
+
+#include "GraphTraits.hpp"
+#include "Intern/TraitHooks.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Number of neighbors of a node
+ *
+ * Uses the optional 'degree' hook of the \ref ConsensLib::GraphTraits if present
+ * and iterates over the adjacency list otherwise.
+ */
+template<typename Graph,
+         typename Node = typename GraphTraits<Graph>::Node>
+size_t getDegree(
+    const Node& node,
+    const Graph& graph)
+{
+  return Intern::getDegree(node, graph);
+}
+
+/**
+ * @brief Maximum number of neighbors of a node of the graph
+ *
+ * Uses the optional 'maxDegree' hook of the \ref ConsensLib::GraphTraits if present
+ * and iterates over all nodes otherwise.
+ */
+template<typename Graph>
+size_t getMaxDegree(const Graph& graph)
+{
+  return Intern::getMaxDegree(graph);
+}
+
+/**
+ * @brief Whether two nodes are adjacent, e.g. for testing the structure of a subgraph in a filter
+ *
+ * @param compare Compare function the adjacency lists are sorted by if they are sorted.
+ *
+ * Uses the optional 'isAdjacent' hook of the \ref ConsensLib::GraphTraits if present. Otherwise the
+ * adjacency list of 'n1' is searched, with a binary search if the lists are sorted.
+ */
+template<typename Graph,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename Compare = std::less<Node>>
+bool areAdjacent(
+    const Node& n1,
+    const Node& n2,
+    const Graph& graph,
+    const Compare& compare = Compare())
+{
+  return Intern::areAdjacent(n1, n2, graph, compare);
+}
+} // end namespace ConsensLib
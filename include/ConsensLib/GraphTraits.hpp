@@ -27,6 +27,29 @@ namespace ConsensLib {
  * 'listsSorted' which is static, takes no arguments
  * and returns true if all adjacency lists are sorted.
  *
+ * Optionally, detected automatically if present:
+ *
+ * 'degree' which is static, takes a node and the graph as arguments
+ * and returns the number of neighbors of the node.
+ *
+ * 'isAdjacent' which is static, takes two nodes and the graph as arguments
+ * and returns true if the nodes are adjacent.
+ *
+ * 'index' which is static, takes a node and the graph as arguments and returns a unique
+ * index of the node smaller than 'nodeCount', which is static, takes the graph as argument
+ * and returns the size of the index range. Both must be given together.
+ *
+ * 'maxDegree' which is static, takes the graph as argument
+ * and returns the maximum degree of a node.
+ *
+ * With 'index' the enumeration keeps the state of the nodes in dense arrays instead of sorted sets,
+ * 'degree' and 'maxDegree' are used to size buffers and statistics without iterating over the adjacency
+ * lists. Without them the enumeration falls back to the iterators, with the same results.
+ * 'isAdjacent' is not needed by the enumeration, which only iterates over adjacency lists; it serves
+ * filters through \ref ConsensLib::areAdjacent and the adjacency tests of the subgraph counting on
+ * its internal \ref ConsensLib::CsrGraph.
+ * See \ref ConsensLib::CsrGraph for a specification providing all of them.
+ *
  * For example template specifications see the example and test files.
  */
 template<typename Graph>
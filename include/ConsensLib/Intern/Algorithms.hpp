@@ -0,0 +1,517 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "../CsrGraph.hpp"
+#include "../GraphTraits.hpp"
+#include "../Types.hpp"
+#include "Enumeration.hpp"
+#include "IndexGraph.hpp"
+#include "TraitHooks.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Recursion of CONSENS with the candidate and forbidden nodes kept as states of a dense
+ *        array over the nodes of an index graph instead of sorted sets.
+ *
+ * The nodes smaller than the root are forbidden implicitly and the candidates excluded by earlier
+ * siblings are marked in place, so extending a subgraph by a node only takes time linear in
+ * the degree of the node plus the number of candidates copied to the child. Sorted set operations
+ * instead take time linear in the number of forbidden nodes, which grows with the index of the root.
+ */
+template<typename FilterFunc,
+         typename Visitor>
+class SimpleSearch
+{
+public:
+
+  SimpleSearch(
+      const CsrGraph<uint32_t>& graph,
+      size_t upper,
+      const FilterFunc& filter,
+      Visitor& visitor)
+    : m_graph(graph),
+      m_upper(upper),
+      m_filter(filter),
+      m_visitor(visitor),
+      m_states(graph.nofNodes(), FREE) {}
+
+  void run()
+  {
+    if (m_upper == 0) {
+      return;
+    }
+    for (uint32_t root = 0; root < m_graph.nofNodes(); ++root) {
+      m_root = root;
+      m_states[root] = CONTAINED;
+      m_current.assign(1, root);
+      std::vector<uint32_t> candidates;
+      for (const uint32_t* iter = m_graph.neighborsBegin(root); iter != m_graph.neighborsEnd(root); ++iter) {
+        if (*iter > root) {
+          m_states[*iter] = CANDIDATE;
+          candidates.push_back(*iter);
+        }
+      }
+      m_visitor.push(root);
+      generateRecursive(candidates);
+      m_visitor.pop(root);
+      for (uint32_t candidate : candidates) {
+        m_states[candidate] = FREE;
+      }
+      m_states[root] = FREE;
+    }
+  }
+
+private:
+
+  enum State : uint8_t {
+    FREE,
+    CANDIDATE,
+    CONTAINED,
+    EXCLUDED
+  };
+
+  void generateRecursive(const std::vector<uint32_t>& candidates)
+  {
+    if (m_filter(m_current)) {
+      m_visitor.emit(m_current);
+    }
+    if (m_current.size() >= m_upper || !m_visitor.expand(m_current, candidates)) {
+      return;
+    }
+    for (auto candidateIter = candidates.begin(); candidateIter != candidates.end(); ++candidateIter) {
+      uint32_t node = *candidateIter;
+      m_states[node] = CONTAINED;
+      m_current.push_back(node);
+      std::vector<uint32_t> nextCandidates(candidateIter + 1, candidates.end());
+      size_t nofInherited = nextCandidates.size();
+      for (const uint32_t* iter = m_graph.neighborsBegin(node); iter != m_graph.neighborsEnd(node); ++iter) {
+        if (*iter > m_root && m_states[*iter] == FREE) {
+          m_states[*iter] = CANDIDATE;
+          nextCandidates.push_back(*iter);
+        }
+      }
+      m_visitor.push(node);
+      generateRecursive(nextCandidates);
+      m_visitor.pop(node);
+      for (auto iter = nextCandidates.begin() + nofInherited; iter != nextCandidates.end(); ++iter) {
+        m_states[*iter] = FREE;
+      }
+      m_current.pop_back();
+      m_states[node] = EXCLUDED;
+    }
+    for (uint32_t candidate : candidates) {
+      m_states[candidate] = CANDIDATE;
+    }
+  }
+
+  const CsrGraph<uint32_t>& m_graph;
+  size_t m_upper;
+  const FilterFunc& m_filter;
+  Visitor& m_visitor;
+  std::vector<State> m_states;
+  std::vector<uint32_t> m_current;
+  uint32_t m_root = 0;
+};
+
+/**
+ * @brief The ESU algorithm of Wernicke enumerating connected induced subgraphs on an index graph.
+ *
+ * A subgraph with smallest node r is extended by one node w of its extension set at a time; w is
+ * removed from the extension set of the following siblings, and the extension set of the child
+ * additionally receives the exclusive neighbors of w larger than r, i.e. those neither contained
+ * in nor adjacent to the subgraph. Membership in the closed neighborhood of the subgraph is kept
+ * as a counter per node, so each extension takes time linear in the degree of w plus the size of
+ * the copied extension set.
+ */
+template<typename FilterFunc,
+         typename Visitor>
+class EsuSearch
+{
+public:
+
+  EsuSearch(
+      const CsrGraph<uint32_t>& graph,
+      size_t upper,
+      const FilterFunc& filter,
+      Visitor& visitor)
+    : m_graph(graph),
+      m_upper(upper),
+      m_filter(filter),
+      m_visitor(visitor),
+      m_closedCounts(graph.nofNodes(), 0) {}
+
+  void run()
+  {
+    if (m_upper == 0) {
+      return;
+    }
+    for (uint32_t root = 0; root < m_graph.nofNodes(); ++root) {
+      m_root = root;
+      std::vector<uint32_t> extension;
+      for (const uint32_t* iter = m_graph.neighborsBegin(root); iter != m_graph.neighborsEnd(root); ++iter) {
+        if (*iter > root) {
+          extension.push_back(*iter);
+        }
+      }
+      add(root);
+      extendRecursive(extension);
+      remove(root);
+    }
+  }
+
+private:
+
+  void add(uint32_t node)
+  {
+    m_current.push_back(node);
+    ++m_closedCounts[node];
+    for (const uint32_t* iter = m_graph.neighborsBegin(node); iter != m_graph.neighborsEnd(node); ++iter) {
+      ++m_closedCounts[*iter];
+    }
+    m_visitor.push(node);
+  }
+
+  void remove(uint32_t node)
+  {
+    m_visitor.pop(node);
+    for (const uint32_t* iter = m_graph.neighborsBegin(node); iter != m_graph.neighborsEnd(node); ++iter) {
+      --m_closedCounts[*iter];
+    }
+    --m_closedCounts[node];
+    m_current.pop_back();
+  }
+
+  void extendRecursive(std::vector<uint32_t>& extension)
+  {
+    if (m_filter(m_current)) {
+      m_visitor.emit(m_current);
+    }
+    if (m_current.size() >= m_upper || !m_visitor.expand(m_current, extension)) {
+      return;
+    }
+    while (!extension.empty()) {
+      uint32_t node = extension.back();
+      extension.pop_back();
+      std::vector<uint32_t> nextExtension(extension);
+      for (const uint32_t* iter = m_graph.neighborsBegin(node); iter != m_graph.neighborsEnd(node); ++iter) {
+        if (*iter > m_root && m_closedCounts[*iter] == 0) {
+          nextExtension.push_back(*iter);
+        }
+      }
+      add(node);
+      extendRecursive(nextExtension);
+      remove(node);
+    }
+  }
+
+  const CsrGraph<uint32_t>& m_graph;
+  size_t m_upper;
+  const FilterFunc& m_filter;
+  Visitor& m_visitor;
+  std::vector<uint32_t> m_closedCounts;
+  std::vector<uint32_t> m_current;
+  uint32_t m_root = 0;
+};
+
+/**
+ * @brief Reverse search enumerating connected induced subgraphs on an index graph.
+ *
+ * The parent of a subgraph with at least two nodes is the subgraph without its largest node
+ * whose removal keeps it connected, i.e. its largest node that is no cut vertex. The children of
+ * a subgraph are found by adding each neighbor u and testing whether u is the largest non-cut
+ * vertex of the result, which only requires the cut vertices larger than u. Apart from the
+ * recursion no candidate or forbidden sets are stored, at the price of a search for cut vertices
+ * in time linear in the size of the subgraph and its edges per neighbor that is not the largest node.
+ */
+template<typename FilterFunc,
+         typename Visitor>
+class ReverseSearch
+{
+public:
+
+  ReverseSearch(
+      const CsrGraph<uint32_t>& graph,
+      size_t upper,
+      const FilterFunc& filter,
+      Visitor& visitor)
+    : m_graph(graph),
+      m_upper(upper),
+      m_filter(filter),
+      m_visitor(visitor),
+      m_positions(graph.nofNodes(), NONE),
+      m_stamps(graph.nofNodes(), 0) {}
+
+  void run()
+  {
+    if (m_upper == 0) {
+      return;
+    }
+    for (uint32_t root = 0; root < m_graph.nofNodes(); ++root) {
+      add(root);
+      generateRecursive();
+      remove(root);
+    }
+  }
+
+private:
+
+  static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+  void add(uint32_t node)
+  {
+    m_positions[node] = static_cast<uint32_t>(m_current.size());
+    m_current.push_back(node);
+    m_visitor.push(node);
+  }
+
+  void remove(uint32_t node)
+  {
+    m_visitor.pop(node);
+    m_current.pop_back();
+    m_positions[node] = NONE;
+  }
+
+  /**
+   * @brief Mark the cut vertices of the current subgraph by an iterative depth-first search
+   *        computing the low points of all nodes.
+   */
+  void computeCutVertices()
+  {
+    size_t size = m_current.size();
+    m_order.assign(size, NONE);
+    m_low.assign(size, 0);
+    m_isCut.assign(size, false);
+    std::vector<std::pair<uint32_t, const uint32_t*>> stack;
+    uint32_t counter = 0;
+    m_order[0] = m_low[0] = counter++;
+    stack.emplace_back(0, m_graph.neighborsBegin(m_current[0]));
+    size_t nofRootChildren = 0;
+    while (!stack.empty()) {
+      uint32_t pos = stack.back().first;
+      const uint32_t*& iter = stack.back().second;
+      if (iter == m_graph.neighborsEnd(m_current[pos])) {
+        stack.pop_back();
+        if (!stack.empty()) {
+          uint32_t parent = stack.back().first;
+          m_low[parent] = std::min(m_low[parent], m_low[pos]);
+          if (parent != 0 && m_low[pos] >= m_order[parent]) {
+            m_isCut[parent] = true;
+          }
+        }
+        continue;
+      }
+      uint32_t neighborPos = m_positions[*iter];
+      ++iter;
+      if (neighborPos == NONE) {
+        continue;
+      }
+      if (m_order[neighborPos] == NONE) {
+        m_order[neighborPos] = m_low[neighborPos] = counter++;
+        if (pos == 0) {
+          ++nofRootChildren;
+        }
+        stack.emplace_back(neighborPos, m_graph.neighborsBegin(m_current[neighborPos]));
+      }
+      else {
+        m_low[pos] = std::min(m_low[pos], m_order[neighborPos]);
+      }
+    }
+    m_isCut[0] = nofRootChildren > 1;
+  }
+
+  /**
+   * @brief Check whether the last node of the current subgraph is its largest non-cut vertex.
+   */
+  bool lastIsLargestNonCut()
+  {
+    uint32_t node = m_current.back();
+    bool larger = false;
+    for (uint32_t other : m_current) {
+      larger = larger || other > node;
+    }
+    if (!larger) {
+      return true;
+    }
+    computeCutVertices();
+    for (size_t pos = 0; pos + 1 < m_current.size(); ++pos) {
+      if (m_current[pos] > node && !m_isCut[pos]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void generateRecursive()
+  {
+    if (m_filter(m_current)) {
+      m_visitor.emit(m_current);
+    }
+    if (m_current.size() >= m_upper) {
+      return;
+    }
+    ++m_stamp;
+    std::vector<uint32_t> neighbors;
+    for (uint32_t node : m_current) {
+      for (const uint32_t* iter = m_graph.neighborsBegin(node); iter != m_graph.neighborsEnd(node); ++iter) {
+        if (m_positions[*iter] == NONE && m_stamps[*iter] != m_stamp) {
+          m_stamps[*iter] = m_stamp;
+          neighbors.push_back(*iter);
+        }
+      }
+    }
+    if (!m_visitor.expand(m_current, neighbors)) {
+      return;
+    }
+    for (uint32_t neighbor : neighbors) {
+      add(neighbor);
+      if (lastIsLargestNonCut()) {
+        generateRecursive();
+      }
+      remove(neighbor);
+    }
+  }
+
+  const CsrGraph<uint32_t>& m_graph;
+  size_t m_upper;
+  const FilterFunc& m_filter;
+  Visitor& m_visitor;
+  std::vector<uint32_t> m_positions;
+  std::vector<size_t> m_stamps;
+  size_t m_stamp = 0;
+  std::vector<uint32_t> m_current;
+  std::vector<uint32_t> m_order;
+  std::vector<uint32_t> m_low;
+  std::vector<bool> m_isCut;
+};
+
+template<typename FilterFunc,
+         typename Visitor>
+constexpr uint32_t ReverseSearch<FilterFunc, Visitor>::NONE;
+
+/**
+ * @brief Choose the enumeration algorithm from cheap statistics of the graph.
+ *
+ * @param nofNodes Number of nodes of the graph.
+ * @param nofEdges Number of edges of the graph.
+ * @param maxDegree Maximum degree of the graph.
+ * @param upper Upper bound for the size of the subgraphs.
+ *
+ * Only used for graphs without the 'index' hook. The thresholds follow the benchmark on adjacency
+ * lists without hooks in src/Benchmark. The dense node states make SIMPLE 2 to 80 times faster than
+ * CONSENS on sorted sets, most on large sparse graphs where the forbidden sets of CONSENS grow with
+ * the number of nodes. ESU is as fast or up to 15 percent faster than SIMPLE on sparse graphs with
+ * cycles and branching nodes, i.e. an average degree between two and four and a node of degree four
+ * or more, where few neighbors are exclusive. On trees, ladders and denser graphs SIMPLE is as fast or
+ * up to 1.5 times faster, apart from a few percent for ESU on random graphs of average degree eight.
+ * Reverse search is never the fastest.
+ */
+inline EnumerationAlgorithm selectAlgorithm(
+    size_t nofNodes,
+    size_t nofEdges,
+    size_t maxDegree,
+    size_t upper)
+{
+  if (upper > 2 && nofEdges >= nofNodes && nofEdges <= 2 * nofNodes && maxDegree >= 4) {
+    return EnumerationAlgorithm::ESU;
+  }
+  return EnumerationAlgorithm::SIMPLE;
+}
+
+/**
+ * @brief Choose the enumeration algorithm for a graph. See \ref selectAlgorithm.
+ *
+ * If the traits provide the 'index' hook, CONSENS runs on dense node states directly on the graph
+ * without copying it, which is the fastest algorithm on all graphs of the benchmark on CsrGraph.
+ */
+template<typename Graph>
+EnumerationAlgorithm selectAlgorithm(
+    const Graph& graph,
+    size_t upper)
+{
+  if (HasIndexHook<Graph>::value) {
+    return EnumerationAlgorithm::CONSENS;
+  }
+  size_t nofNodes = 0;
+  size_t nofEntries = 0;
+  size_t maxDegree = 0;
+  for (auto nodeIter = GraphTraits<Graph>::nodesBegin(graph); nodeIter != GraphTraits<Graph>::nodesEnd(graph); ++nodeIter) {
+    size_t degree = Intern::getDegree(*nodeIter, graph);
+    ++nofNodes;
+    nofEntries += degree;
+    maxDegree = std::max(maxDegree, degree);
+  }
+  return selectAlgorithm(nofNodes, nofEntries / 2, maxDegree, upper);
+}
+
+/**
+ * @brief Perform the enumeration with a given algorithm and report it to a visitor.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the enumeration events.
+ *
+ * @param graph The input graph
+ * @param algorithm The enumeration algorithm. See \ref ConsensLib::EnumerationAlgorithm.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the subgraphs.
+ *        Must accept std::vector<Node> as input and return a boolean.
+ * @param visitor Receives the push, pop and emit events of the enumeration.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ *
+ * CONSENS runs directly on the input graph, all other algorithms on an index graph relabeled by
+ * 'compare'. Every algorithm asks the visitor whether to expand a subgraph, passing the nodes the
+ * algorithm may add next: the candidates for CONSENS and SIMPLE, the extension set for ESU and all
+ * neighbors of the subgraph for reverse search. Returning false prunes the super graphs below the
+ * subgraph in the recursion of the respective algorithm, which differ between algorithms. A visitor
+ * pruning only subgraphs none of whose super graphs are wanted gives the same result with every algorithm.
+ */
+template<typename Graph,
+         typename Node,
+         typename FilterFunc,
+         typename Compare,
+         typename Visitor>
+void visitAlgorithmEnumeration(
+    const Graph& graph,
+    EnumerationAlgorithm algorithm,
+    size_t upper,
+    const FilterFunc& filter,
+    Visitor& visitor,
+    const Compare& compare)
+{
+  if (algorithm == EnumerationAlgorithm::AUTO) {
+    algorithm = selectAlgorithm(graph, upper);
+  }
+  if (algorithm == EnumerationAlgorithm::CONSENS) {
+    visitEnumeration<Graph, Node>(graph, upper, filter, visitor, compare);
+    return;
+  }
+  IndexGraph<Node> indexGraph = buildIndexGraph<Graph, Node>(graph, compare);
+  MappingVisitor<Node, Compare, Visitor> mappingVisitor(indexGraph.nodes, visitor, compare);
+  MappedFilter<Node, FilterFunc, Compare> mappedFilter(indexGraph.nodes, filter, compare);
+  using MappedFilterType = MappedFilter<Node, FilterFunc, Compare>;
+  using MappingVisitorType = MappingVisitor<Node, Compare, Visitor>;
+  switch (algorithm) {
+  case EnumerationAlgorithm::ESU:
+    EsuSearch<MappedFilterType, MappingVisitorType>(indexGraph.graph, upper, mappedFilter, mappingVisitor).run();
+    break;
+  case EnumerationAlgorithm::REVERSE_SEARCH:
+    ReverseSearch<MappedFilterType, MappingVisitorType>(indexGraph.graph, upper, mappedFilter, mappingVisitor).run();
+    break;
+  default:
+    SimpleSearch<MappedFilterType, MappingVisitorType>(indexGraph.graph, upper, mappedFilter, mappingVisitor).run();
+    break;
+  }
+}
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Lock-free bounded multi-producer multi-consumer queue.
+ *
+ * @tparam T Type of the elements. Must be default constructible and move assignable.
+ *
+ * Ring buffer of cells that carry a sequence number each (D. Vyukov's bounded MPMC queue).
+ * Producers and consumers claim positions with a compare-and-swap on their respective counter
+ * and publish a cell by advancing its sequence number, so 'tryPush' and 'tryPop' never block.
+ * The blocking 'push' and 'pop' retry them a few times and then sleep on a condition variable
+ * until the other side makes progress or the queue is closed. The mutex is only taken to sleep
+ * and to wake sleeping threads, so it is never touched while no thread sleeps.
+ * The capacity is rounded up to the next power of two and is at least two, since with a single
+ * cell a full queue cannot be distinguished from an empty one.
+ */
+template<typename T>
+class BoundedQueue
+{
+public:
+
+  explicit BoundedQueue(size_t capacity)
+    : m_capacity(roundUp(capacity)),
+      m_cells(new Cell[m_capacity]),
+      m_enqueuePos(0),
+      m_dequeuePos(0),
+      m_closed(false),
+      m_nofSleepingProducers(0),
+      m_nofSleepingConsumers(0)
+  {
+    for (size_t pos = 0; pos < m_capacity; ++pos) {
+      m_cells[pos].sequence.store(pos, std::memory_order_relaxed);
+    }
+  }
+
+  BoundedQueue(const BoundedQueue&) = delete;
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+  /**
+   * @brief Move 'value' into the queue. Returns false without moving if the queue is full.
+   */
+  bool tryPush(T& value)
+  {
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+      cell = &m_cells[pos & (m_capacity - 1)];
+      size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+      if (difference == 0) {
+        if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      else if (difference < 0) {
+        return false;
+      }
+      else {
+        pos = m_enqueuePos.load(std::memory_order_relaxed);
+      }
+    }
+    cell->data = std::move(value);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Move the front element into 'value'. Returns false if the queue is empty.
+   */
+  bool tryPop(T& value)
+  {
+    size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+      cell = &m_cells[pos & (m_capacity - 1)];
+      size_t sequence = cell->sequence.load(std::memory_order_acquire);
+      std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+      if (difference == 0) {
+        if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      else if (difference < 0) {
+        return false;
+      }
+      else {
+        pos = m_dequeuePos.load(std::memory_order_relaxed);
+      }
+    }
+    value = std::move(cell->data);
+    cell->sequence.store(pos + m_capacity, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Move 'value' into the queue, waiting while it is full.
+   *        Returns false without moving if the queue is closed.
+   */
+  bool push(T& value)
+  {
+    for (unsigned spin = 0; spin < SPIN_COUNT; ++spin) {
+      if (isClosed()) {
+        return false;
+      }
+      if (tryPush(value)) {
+        wake(m_notEmpty, m_nofSleepingConsumers);
+        return true;
+      }
+      std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_nofSleepingProducers.fetch_add(1);
+    bool pushed = false;
+    while (true) {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (isClosed()) {
+        break;
+      }
+      if (tryPush(value)) {
+        pushed = true;
+        break;
+      }
+      m_notFull.wait(lock);
+    }
+    m_nofSleepingProducers.fetch_sub(1);
+    lock.unlock();
+    if (pushed) {
+      wake(m_notEmpty, m_nofSleepingConsumers);
+    }
+    return pushed;
+  }
+
+  /**
+   * @brief Move the front element into 'value', waiting while the queue is empty.
+   *        Returns false if the queue is closed and empty.
+   */
+  bool pop(T& value)
+  {
+    for (unsigned spin = 0; spin < SPIN_COUNT; ++spin) {
+      if (tryPop(value)) {
+        wake(m_notFull, m_nofSleepingProducers);
+        return true;
+      }
+      if (isClosed()) {
+        return tryPop(value);
+      }
+      std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_nofSleepingConsumers.fetch_add(1);
+    bool popped = false;
+    while (true) {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (tryPop(value)) {
+        popped = true;
+        break;
+      }
+      if (isClosed()) {
+        popped = tryPop(value);
+        break;
+      }
+      m_notEmpty.wait(lock);
+    }
+    m_nofSleepingConsumers.fetch_sub(1);
+    lock.unlock();
+    if (popped) {
+      wake(m_notFull, m_nofSleepingProducers);
+    }
+    return popped;
+  }
+
+  /**
+   * @brief Reject all further pushes and wake all waiting threads.
+   *        The elements already in the queue can still be popped.
+   */
+  void close()
+  {
+    m_closed.store(true);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_notFull.notify_all();
+    m_notEmpty.notify_all();
+  }
+
+  bool isClosed() const
+  {
+    return m_closed.load();
+  }
+
+private:
+
+  static constexpr unsigned SPIN_COUNT = 64;
+
+  /**
+   * @brief Wake a thread sleeping on 'condition' after progress was made.
+   *
+   * The fence pairs with the fence of the sleeping thread after it registered in 'nofSleeping':
+   * either this thread sees the registration or the sleeping thread sees the progress.
+   */
+  void wake(
+      std::condition_variable& condition,
+      const std::atomic<size_t>& nofSleeping)
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (nofSleeping.load(std::memory_order_relaxed) > 0) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      condition.notify_one();
+    }
+  }
+
+  struct Cell
+  {
+    std::atomic<size_t> sequence;
+    T data;
+  };
+
+  static size_t roundUp(size_t capacity)
+  {
+    size_t result = 2;
+    while (result < capacity) {
+      result <<= 1;
+    }
+    return result;
+  }
+
+  size_t m_capacity;
+  std::unique_ptr<Cell[]> m_cells;
+  alignas(64) std::atomic<size_t> m_enqueuePos;
+  alignas(64) std::atomic<size_t> m_dequeuePos;
+  alignas(64) std::atomic<bool> m_closed;
+  std::atomic<size_t> m_nofSleepingProducers;
+  std::atomic<size_t> m_nofSleepingConsumers;
+  std::mutex m_mutex;
+  std::condition_variable m_notFull;
+  std::condition_variable m_notEmpty;
+};
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "../Types.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Subgraphs of a canonically labeled graph stored consecutively in one flat array.
+ */
+struct CachedSubgraphs
+{
+  std::vector<uint32_t> nodes;
+  std::vector<size_t> ends;
+
+  size_t bytes() const
+  {
+    return sizeof(CachedSubgraphs) + nodes.size() * sizeof(uint32_t) + ends.size() * sizeof(size_t);
+  }
+};
+
+/**
+ * @brief Visitor appending every emitted subgraph to \ref CachedSubgraphs.
+ */
+struct CachedSubgraphsCollector : public EnumerationVisitor
+{
+  void emit(const std::vector<uint32_t>& subgraph)
+  {
+    subgraphs.nodes.insert(subgraphs.nodes.end(), subgraph.begin(), subgraph.end());
+    subgraphs.ends.push_back(subgraphs.nodes.size());
+  }
+
+  CachedSubgraphs subgraphs;
+};
+
+/**
+ * @brief Key of a cached enumeration: the certificate of the canonical graph and the upper bound.
+ */
+struct CacheKey
+{
+  size_t upper;
+  std::vector<uint32_t> certificate;
+
+  bool operator==(const CacheKey& other) const
+  {
+    return upper == other.upper && certificate == other.certificate;
+  }
+};
+
+struct CacheKeyHash
+{
+  size_t operator()(const CacheKey& key) const
+  {
+    uint64_t hash = 14695981039346656037ull ^ key.upper;
+    for (uint32_t value : key.certificate) {
+      hash = (hash ^ value) * 1099511628211ull;
+    }
+    return static_cast<size_t>(hash);
+  }
+};
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -0,0 +1,495 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "../CsrGraph.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Refine an ordered partition of the nodes to the coarsest equitable partition refining it.
+ *
+ * @param graph The graph.
+ * @param colors Cell of every node. The cells are numbered consecutively in their order.
+ * @param nofCells Number of cells, updated to the number of cells of the refined partition.
+ * @param trace Output receiving a description of the refined partition, namely the size of
+ *        every cell followed by the sorted cells of the neighbors of its nodes.
+ *
+ * Color refinement: every cell is split by the sorted cells of the neighbors of its nodes until
+ * no cell is split anymore. The split cells are ordered by these neighborhoods, so the refined
+ * partition and its trace are invariant under every isomorphism respecting the initial partition.
+ */
+inline void refinePartition(
+    const CsrGraph<uint32_t>& graph,
+    std::vector<uint32_t>& colors,
+    uint32_t& nofCells,
+    std::vector<uint32_t>& trace)
+{
+  size_t nofNodes = graph.nofNodes();
+  std::vector<std::vector<uint32_t>> signatures(nofNodes);
+  std::vector<uint32_t> order(nofNodes);
+  std::vector<uint32_t> refined(nofNodes);
+  auto less = [&colors, &signatures](uint32_t n1, uint32_t n2) {
+    if (colors[n1] != colors[n2]) {
+      return colors[n1] < colors[n2];
+    }
+    return signatures[n1] < signatures[n2];
+  };
+  while (true) {
+    for (uint32_t node = 0; node < nofNodes; ++node) {
+      signatures[node].clear();
+      for (const uint32_t* iter = graph.neighborsBegin(node); iter != graph.neighborsEnd(node); ++iter) {
+        signatures[node].push_back(colors[*iter]);
+      }
+      std::sort(signatures[node].begin(), signatures[node].end());
+    }
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), less);
+    uint32_t cell = 0;
+    for (size_t pos = 0; pos < nofNodes; ++pos) {
+      if (pos > 0 && less(order[pos - 1], order[pos])) {
+        ++cell;
+      }
+      refined[order[pos]] = cell;
+    }
+    uint32_t nofRefined = nofNodes == 0 ? 0 : cell + 1;
+    if (nofRefined == nofCells) {
+      break;
+    }
+    nofCells = nofRefined;
+    colors.swap(refined);
+  }
+  trace.clear();
+  for (size_t pos = 0; pos < nofNodes; ++pos) {
+    if (pos == 0 || colors[order[pos - 1]] != colors[order[pos]]) {
+      size_t size = 1;
+      while (pos + size < nofNodes && colors[order[pos + size]] == colors[order[pos]]) {
+        ++size;
+      }
+      trace.push_back(static_cast<uint32_t>(size));
+      trace.insert(trace.end(), signatures[order[pos]].begin(), signatures[order[pos]].end());
+    }
+  }
+}
+
+/**
+ * @brief Place a node of a cell into a new singleton cell in front of the remaining nodes of the cell.
+ */
+inline void individualize(
+    std::vector<uint32_t>& colors,
+    uint32_t& nofCells,
+    uint32_t node)
+{
+  uint32_t cell = colors[node];
+  for (uint32_t& color : colors) {
+    if (color > cell) {
+      ++color;
+    }
+    else if (color == cell) {
+      color = cell + 1;
+    }
+  }
+  colors[node] = cell;
+  ++nofCells;
+}
+
+/**
+ * @brief First smallest cell of a partition containing more than one node.
+ *        Returns 'nofCells' if the partition is discrete.
+ */
+inline uint32_t getTargetCell(
+    const std::vector<uint32_t>& colors,
+    uint32_t nofCells)
+{
+  std::vector<uint32_t> sizes(nofCells, 0);
+  for (uint32_t color : colors) {
+    ++sizes[color];
+  }
+  uint32_t target = nofCells;
+  for (uint32_t cell = 0; cell < nofCells; ++cell) {
+    if (sizes[cell] > 1 && (target == nofCells || sizes[cell] < sizes[target])) {
+      target = cell;
+    }
+  }
+  return target;
+}
+
+/**
+ * @brief Adjacency lists of a graph relabeled by a discrete partition, each prefixed by its length.
+ *        Two labelings of isomorphic graphs give the same certificate if and only if
+ *        they map the graphs onto the same labeled graph.
+ */
+inline std::vector<uint32_t> getCertificate(
+    const CsrGraph<uint32_t>& graph,
+    const std::vector<uint32_t>& labels)
+{
+  CsrGraph<uint32_t> relabeled = graph.permuted(labels);
+  std::vector<uint32_t> certificate;
+  certificate.reserve(relabeled.nofNodes() + 2 * relabeled.nofEdges());
+  for (uint32_t node = 0; node < relabeled.nofNodes(); ++node) {
+    certificate.push_back(static_cast<uint32_t>(relabeled.degree(node)));
+    certificate.insert(certificate.end(), relabeled.neighborsBegin(node), relabeled.neighborsEnd(node));
+  }
+  return certificate;
+}
+
+/**
+ * @brief Canonical labeling of a graph together with automorphisms found on the way.
+ */
+struct CanonicalLabeling
+{
+  std::vector<uint32_t> labels;                  ///< canonical label of every node
+  std::vector<uint32_t> certificate;             ///< equal for two graphs if and only if they are isomorphic
+  std::vector<std::vector<uint32_t>> generators; ///< automorphisms, each mapping every node to its image
+};
+
+/**
+ * @brief Individualization-refinement search for the canonical labeling of a graph.
+ *
+ * The nodes of the search tree are equitable partitions. A child individualizes one node of the
+ * target cell and refines the partition again, the leaves are discrete partitions, i.e. labelings.
+ * The canonical labeling is the leaf with the smallest sequence of refinement traces on its path
+ * and the smallest certificate among those, which is invariant under isomorphisms.
+ * Subtrees whose traces are larger than the ones of the best leaf are pruned. Two leaves with the
+ * same certificate differ by an automorphism, which is recorded and used to skip children that lie
+ * in the same orbit as an already explored child under the automorphisms fixing the path.
+ *
+ * The refinement takes O(n m log n) time in the worst case, which is intended for graphs of the size
+ * of molecules. The search is exponential only for highly regular graphs without automorphisms.
+ */
+class CanonicalSearch
+{
+public:
+
+  explicit CanonicalSearch(const CsrGraph<uint32_t>& graph)
+    : m_graph(graph),
+      m_equalPrefix(0),
+      m_hasBest(false) {}
+
+  CanonicalLabeling run()
+  {
+    uint32_t nofCells = m_graph.nofNodes() == 0 ? 0 : 1;
+    std::vector<uint32_t> colors(m_graph.nofNodes(), 0);
+    search(colors, nofCells);
+    m_result.labels = m_bestLabels;
+    m_result.certificate = m_bestCertificate;
+    return std::move(m_result);
+  }
+
+private:
+
+  void search(
+      std::vector<uint32_t>& colors,
+      uint32_t nofCells)
+  {
+    size_t level = m_path.size();
+    m_traces.emplace_back();
+    refinePartition(m_graph, colors, nofCells, m_traces.back());
+    if (m_hasBest && m_equalPrefix == level) {
+      if (m_bestTraces.size() <= level || m_bestTraces[level] < m_traces.back()) {
+        m_traces.pop_back();
+        return;
+      }
+      if (m_bestTraces[level] == m_traces.back()) {
+        m_equalPrefix = level + 1;
+      }
+    }
+    uint32_t target = getTargetCell(colors, nofCells);
+    if (target == nofCells) {
+      leaf(colors);
+    }
+    else {
+      std::vector<uint32_t> cell;
+      for (uint32_t node = 0; node < colors.size(); ++node) {
+        if (colors[node] == target) {
+          cell.push_back(node);
+        }
+      }
+      std::vector<uint32_t> explored;
+      for (uint32_t node : cell) {
+        if (inExploredOrbit(node, explored)) {
+          continue;
+        }
+        explored.push_back(node);
+        std::vector<uint32_t> childColors(colors);
+        uint32_t childCells = nofCells;
+        individualize(childColors, childCells, node);
+        m_path.push_back(node);
+        search(childColors, childCells);
+        m_path.pop_back();
+        m_equalPrefix = std::min(m_equalPrefix, level + 1);
+      }
+    }
+    m_traces.pop_back();
+  }
+
+  void leaf(const std::vector<uint32_t>& labels)
+  {
+    std::vector<uint32_t> certificate = getCertificate(m_graph, labels);
+    if (!m_hasBest) {
+      m_firstLabels = labels;
+      m_firstCertificate = certificate;
+      replaceBest(labels, certificate);
+      return;
+    }
+    if (certificate == m_firstCertificate) {
+      addAutomorphism(labels, m_firstLabels);
+    }
+    else if (certificate == m_bestCertificate) {
+      addAutomorphism(labels, m_bestLabels);
+    }
+    bool better = m_equalPrefix < m_traces.size()
+        || (m_bestTraces.size() == m_traces.size() && certificate < m_bestCertificate);
+    if (better) {
+      replaceBest(labels, certificate);
+    }
+  }
+
+  void replaceBest(
+      const std::vector<uint32_t>& labels,
+      std::vector<uint32_t>& certificate)
+  {
+    m_hasBest = true;
+    m_bestLabels = labels;
+    m_bestCertificate.swap(certificate);
+    m_bestTraces = m_traces;
+    m_equalPrefix = m_traces.size();
+  }
+
+  /**
+   * Record the automorphism mapping every node to the node of the same label in 'other'.
+   */
+  void addAutomorphism(
+      const std::vector<uint32_t>& labels,
+      const std::vector<uint32_t>& other)
+  {
+    std::vector<uint32_t> inverse(other.size());
+    for (uint32_t node = 0; node < other.size(); ++node) {
+      inverse[other[node]] = node;
+    }
+    std::vector<uint32_t> automorphism(labels.size());
+    bool identity = true;
+    for (uint32_t node = 0; node < labels.size(); ++node) {
+      automorphism[node] = inverse[labels[node]];
+      identity = identity && automorphism[node] == node;
+    }
+    if (!identity) {
+      m_result.generators.push_back(std::move(automorphism));
+    }
+  }
+
+  /**
+   * Whether 'node' lies in the orbit of an explored node under the automorphisms fixing the path.
+   */
+  bool inExploredOrbit(
+      uint32_t node,
+      const std::vector<uint32_t>& explored) const
+  {
+    if (explored.empty() || m_result.generators.empty()) {
+      return false;
+    }
+    std::vector<uint32_t> parent(m_graph.nofNodes());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](uint32_t x) {
+      while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+      }
+      return x;
+    };
+    for (const std::vector<uint32_t>& generator : m_result.generators) {
+      bool fixesPath = std::all_of(m_path.begin(), m_path.end(), [&generator](uint32_t fixed) {
+        return generator[fixed] == fixed;
+      });
+      if (!fixesPath) {
+        continue;
+      }
+      for (uint32_t x = 0; x < generator.size(); ++x) {
+        parent[find(x)] = find(generator[x]);
+      }
+    }
+    uint32_t root = find(node);
+    return std::any_of(explored.begin(), explored.end(), [&find, root](uint32_t other) {
+      return find(other) == root;
+    });
+  }
+
+  const CsrGraph<uint32_t>& m_graph;
+  std::vector<uint32_t> m_path;
+  std::vector<std::vector<uint32_t>> m_traces;
+  size_t m_equalPrefix;
+  bool m_hasBest;
+  std::vector<uint32_t> m_bestLabels;
+  std::vector<uint32_t> m_bestCertificate;
+  std::vector<std::vector<uint32_t>> m_bestTraces;
+  std::vector<uint32_t> m_firstLabels;
+  std::vector<uint32_t> m_firstCertificate;
+  CanonicalLabeling m_result;
+};
+
+/**
+ * @brief Compute the canonical labeling of a graph. See \ref CanonicalSearch.
+ */
+inline CanonicalLabeling canonicalLabeling(const CsrGraph<uint32_t>& graph)
+{
+  return CanonicalSearch(graph).run();
+}
+
+/**
+ * @brief Elements of the automorphism group of a graph.
+ */
+struct AutomorphismGroup
+{
+  std::vector<std::vector<uint32_t>> elements; ///< all elements, each mapping every node to its image; the identity first
+  bool complete = true;                        ///< false if only a stabilizer subgroup was enumerated
+};
+
+namespace Detail {
+
+/**
+ * Level of the first path of the individualization-refinement search tree.
+ */
+struct SearchLevel
+{
+  std::vector<uint32_t> colors;
+  uint32_t nofCells;
+  std::vector<uint32_t> trace;
+  std::vector<uint32_t> cell;
+};
+
+/**
+ * Search the subtree of a partition for a leaf with the certificate of the first leaf
+ * whose refinement traces equal the ones of the first path.
+ */
+inline bool findAutomorphism(
+    const CsrGraph<uint32_t>& graph,
+    std::vector<uint32_t>& colors,
+    uint32_t nofCells,
+    size_t depth,
+    const std::vector<SearchLevel>& levels,
+    const std::vector<uint32_t>& firstCertificate,
+    const std::vector<uint32_t>& firstInverse,
+    std::vector<uint32_t>& automorphism)
+{
+  std::vector<uint32_t> trace;
+  refinePartition(graph, colors, nofCells, trace);
+  if (depth >= levels.size() || trace != levels[depth].trace) {
+    return false;
+  }
+  uint32_t target = getTargetCell(colors, nofCells);
+  if (target == nofCells) {
+    if (getCertificate(graph, colors) != firstCertificate) {
+      return false;
+    }
+    automorphism.resize(colors.size());
+    for (uint32_t node = 0; node < colors.size(); ++node) {
+      automorphism[node] = firstInverse[colors[node]];
+    }
+    return true;
+  }
+  for (uint32_t node = 0; node < colors.size(); ++node) {
+    if (colors[node] == target) {
+      std::vector<uint32_t> childColors(colors);
+      uint32_t childCells = nofCells;
+      individualize(childColors, childCells, node);
+      if (findAutomorphism(graph, childColors, childCells, depth + 1, levels,
+                           firstCertificate, firstInverse, automorphism)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+} // end namespace Detail
+
+/**
+ * @brief Enumerate all automorphisms of a graph up to a maximum number.
+ *
+ * @param graph The graph.
+ * @param maxSize Maximum number of automorphisms to enumerate.
+ *
+ * Follows the first path p_0, p_1, ... of the individualization-refinement search tree down to a
+ * leaf and builds the chain of pointwise stabilizers G_k of p_0, ..., p_{k-1} from the bottom up.
+ * G_k is the union of the cosets G_{k+1} g over the nodes v of the target cell on level k, where g
+ * is any automorphism mapping v to p_k, found as a leaf in the subtree of v with the same traces
+ * and certificate as the first leaf.
+ * If G_k has more than 'maxSize' elements, the complete subgroup G_{k+1} is returned instead.
+ */
+inline AutomorphismGroup enumerateAutomorphisms(
+    const CsrGraph<uint32_t>& graph,
+    size_t maxSize)
+{
+  size_t nofNodes = graph.nofNodes();
+  std::vector<Detail::SearchLevel> levels;
+  std::vector<uint32_t> colors(nofNodes, 0);
+  uint32_t nofCells = nofNodes == 0 ? 0 : 1;
+  while (true) {
+    Detail::SearchLevel level;
+    refinePartition(graph, colors, nofCells, level.trace);
+    level.colors = colors;
+    level.nofCells = nofCells;
+    uint32_t target = getTargetCell(colors, nofCells);
+    for (uint32_t node = 0; node < nofNodes; ++node) {
+      if (target != nofCells && colors[node] == target) {
+        level.cell.push_back(node);
+      }
+    }
+    levels.push_back(std::move(level));
+    if (target == nofCells) {
+      break;
+    }
+    individualize(colors, nofCells, levels.back().cell.front());
+  }
+  std::vector<uint32_t> firstCertificate = getCertificate(graph, colors);
+  std::vector<uint32_t> firstInverse(nofNodes);
+  for (uint32_t node = 0; node < nofNodes; ++node) {
+    firstInverse[colors[node]] = node;
+  }
+
+  AutomorphismGroup group;
+  group.elements.emplace_back(nofNodes);
+  std::iota(group.elements.front().begin(), group.elements.front().end(), 0);
+  for (size_t depth = levels.size() - 1; depth-- > 0;) {
+    const Detail::SearchLevel& level = levels[depth];
+    uint32_t fixed = level.cell.front();
+    size_t stabilizerSize = group.elements.size();
+    std::vector<bool> covered(nofNodes, false);
+    covered[fixed] = true;
+    for (uint32_t node : level.cell) {
+      if (covered[node]) {
+        continue;
+      }
+      std::vector<uint32_t> childColors(level.colors);
+      uint32_t childCells = level.nofCells;
+      individualize(childColors, childCells, node);
+      std::vector<uint32_t> automorphism;
+      if (!Detail::findAutomorphism(graph, childColors, childCells, depth + 1, levels,
+                                    firstCertificate, firstInverse, automorphism)) {
+        continue;
+      }
+      if (group.elements.size() + stabilizerSize > maxSize) {
+        group.elements.resize(stabilizerSize);
+        group.complete = false;
+        return group;
+      }
+      for (size_t pos = 0; pos < stabilizerSize; ++pos) {
+        std::vector<uint32_t> element(nofNodes);
+        for (uint32_t x = 0; x < nofNodes; ++x) {
+          element[x] = group.elements[pos][automorphism[x]];
+        }
+        group.elements.push_back(std::move(element));
+      }
+      covered[node] = true;
+    }
+  }
+  return group;
+}
+
+} // end namespace Intern
+} // end namespace ConsensLib
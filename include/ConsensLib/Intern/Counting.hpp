@@ -0,0 +1,365 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../CsrGraph.hpp"
+#include "../Types.hpp"
+#include "Enumeration.hpp"
+#include "TraitHooks.hpp"
+#include "TreeDecomposition.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Dynamic programming over a tree decomposition counting connected induced subgraphs by size.
+ *
+ * The partial solutions of a subtree of the decomposition are classified by their intersection
+ * with the bag of the subtree root. A state assigns each bag node either zero (not contained) or
+ * the label of its connected component within the partial solution. Labels are numbered
+ * by first occurrence, four bits per bag node, so bags hold at most 15 nodes. The highest bit of a
+ * state marks partial solutions containing a complete component that has no node in the bag anymore.
+ * No further node may be added to such a solution. Each state stores the number of partial
+ * solutions per size up to a limit.
+ */
+class DecompositionCounter
+{
+public:
+
+  static constexpr size_t MAX_BAG_SIZE = 15;
+
+  DecompositionCounter(
+      const CsrGraph<uint32_t>& graph,
+      size_t limit)
+    : m_graph(graph),
+      m_limit(limit) {}
+
+  /**
+   * @brief Count all connected induced subgraphs with at most 'limit' nodes.
+   *
+   * @param decomposition Tree decomposition of the graph with bags of at most \ref MAX_BAG_SIZE nodes.
+   *
+   * @return The number of subgraphs for every size from zero to 'limit'.
+   */
+  std::vector<size_t> count(const TreeDecomposition& decomposition)
+  {
+    std::vector<size_t> counts(m_limit + 1, 0);
+    std::vector<Table> pending(decomposition.bags.size());
+    std::vector<bool> hasPending(decomposition.bags.size(), false);
+    for (size_t idx = 0; idx < decomposition.bags.size(); ++idx) {
+      std::vector<uint32_t> bag = decomposition.bags[idx];
+      Table table;
+      if (hasPending[idx]) {
+        table.swap(pending[idx]);
+      }
+      else {
+        table = transform(leafTable(), std::vector<uint32_t>(), bag);
+      }
+      size_t parent = decomposition.parents[idx];
+      if (parent == TreeDecomposition::NO_PARENT) {
+        table = transform(table, bag, std::vector<uint32_t>());
+        auto foundIter = table.find(static_cast<uint64_t>(DONE));
+        if (foundIter != table.end()) {
+          for (size_t size = 0; size < foundIter->second.size(); ++size) {
+            counts[size] += foundIter->second[size];
+          }
+        }
+        continue;
+      }
+      table = transform(table, bag, decomposition.bags[parent]);
+      if (hasPending[parent]) {
+        pending[parent] = join(pending[parent], table, decomposition.bags[parent].size());
+      }
+      else {
+        pending[parent].swap(table);
+        hasPending[parent] = true;
+      }
+    }
+    return counts;
+  }
+
+private:
+
+  using Table = std::unordered_map<uint64_t, std::vector<uint64_t>>;
+
+  static constexpr uint64_t DONE = uint64_t(1) << 63;
+
+  static unsigned getLabel(uint64_t state, size_t pos)
+  {
+    return static_cast<unsigned>((state >> (4 * pos)) & 0xf);
+  }
+
+  static uint64_t encode(const unsigned* labels, size_t size, bool done)
+  {
+    unsigned relabel[16] = {0};
+    unsigned nofLabels = 0;
+    uint64_t state = done ? DONE : 0;
+    for (size_t pos = 0; pos < size; ++pos) {
+      if (labels[pos] != 0) {
+        if (relabel[labels[pos]] == 0) {
+          relabel[labels[pos]] = ++nofLabels;
+        }
+        state |= static_cast<uint64_t>(relabel[labels[pos]]) << (4 * pos);
+      }
+    }
+    return state;
+  }
+
+  static Table leafTable()
+  {
+    Table table;
+    table.emplace(0, std::vector<uint64_t>(1, 1));
+    return table;
+  }
+
+  void addCounts(
+      Table& table,
+      uint64_t state,
+      const std::vector<uint64_t>& counts,
+      size_t shift) const
+  {
+    std::vector<uint64_t>* target = nullptr;
+    for (size_t size = 0; size < counts.size() && size + shift <= m_limit; ++size) {
+      if (counts[size] != 0) {
+        if (!target) {
+          target = &table[state];
+        }
+        if (target->size() <= size + shift) {
+          target->resize(size + shift + 1, 0);
+        }
+        (*target)[size + shift] += counts[size];
+      }
+    }
+  }
+
+  bool isAdjacent(uint32_t n1, uint32_t n2) const
+  {
+    return Intern::areAdjacent(n1, n2, m_graph, std::less<uint32_t>());
+  }
+
+  Table introduce(
+      const Table& table,
+      const std::vector<uint32_t>& bag,
+      uint32_t node) const
+  {
+    size_t nodePos = std::lower_bound(bag.begin(), bag.end(), node) - bag.begin();
+    std::vector<bool> adjacent(bag.size());
+    for (size_t pos = 0; pos < bag.size(); ++pos) {
+      adjacent[pos] = isAdjacent(node, bag[pos]);
+    }
+    Table result;
+    unsigned labels[MAX_BAG_SIZE];
+    for (const auto& entry : table) {
+      uint64_t state = entry.first;
+      bool done = (state & DONE) != 0;
+      bool merge[16] = {false};
+      size_t target = 0;
+      for (size_t pos = 0; pos < bag.size(); ++pos) {
+        if (pos == nodePos) {
+          labels[target++] = 0;
+        }
+        labels[target] = getLabel(state, pos);
+        merge[labels[target]] = merge[labels[target]] || (labels[target] != 0 && adjacent[pos]);
+        ++target;
+      }
+      if (nodePos == bag.size()) {
+        labels[target++] = 0;
+      }
+      addCounts(result, encode(labels, target, done), entry.second, 0);
+      if (done) {
+        continue;
+      }
+      // the node joins all components of its neighbors
+      for (size_t pos = 0; pos < target; ++pos) {
+        if (merge[labels[pos]]) {
+          labels[pos] = 15;
+        }
+      }
+      labels[nodePos] = 15;
+      addCounts(result, encode(labels, target, false), entry.second, 1);
+    }
+    return result;
+  }
+
+  Table forget(
+      const Table& table,
+      const std::vector<uint32_t>& bag,
+      uint32_t node) const
+  {
+    size_t nodePos = std::lower_bound(bag.begin(), bag.end(), node) - bag.begin();
+    Table result;
+    unsigned labels[MAX_BAG_SIZE];
+    for (const auto& entry : table) {
+      uint64_t state = entry.first;
+      bool done = (state & DONE) != 0;
+      unsigned label = getLabel(state, nodePos);
+      bool shared = false;
+      bool others = false;
+      for (size_t pos = 0, target = 0; pos < bag.size(); ++pos) {
+        if (pos != nodePos) {
+          labels[target++] = getLabel(state, pos);
+          shared = shared || (label != 0 && getLabel(state, pos) == label);
+          others = others || getLabel(state, pos) != 0;
+        }
+      }
+      if (label != 0 && !shared) {
+        // the component of the node is complete
+        if (others || done) {
+          continue;
+        }
+        done = true;
+      }
+      addCounts(result, encode(labels, bag.size() - 1, done), entry.second, 0);
+    }
+    return result;
+  }
+
+  Table transform(
+      Table table,
+      std::vector<uint32_t> bag,
+      const std::vector<uint32_t>& target) const
+  {
+    std::vector<uint32_t> nodes;
+    std::set_difference(bag.begin(), bag.end(), target.begin(), target.end(), std::back_inserter(nodes));
+    for (uint32_t node : nodes) {
+      table = forget(table, bag, node);
+      bag.erase(std::lower_bound(bag.begin(), bag.end(), node));
+    }
+    nodes.clear();
+    std::set_difference(target.begin(), target.end(), bag.begin(), bag.end(), std::back_inserter(nodes));
+    for (uint32_t node : nodes) {
+      table = introduce(table, bag, node);
+      bag.insert(std::lower_bound(bag.begin(), bag.end(), node), node);
+    }
+    return table;
+  }
+
+  Table join(
+      const Table& table1,
+      const Table& table2,
+      size_t bagSize) const
+  {
+    std::unordered_map<uint64_t, std::vector<std::pair<uint64_t, const std::vector<uint64_t>*>>> byChosen;
+    for (const auto& entry : table2) {
+      byChosen[chosenMask(entry.first, bagSize)].emplace_back(entry.first, &entry.second);
+    }
+    Table result;
+    unsigned labels[MAX_BAG_SIZE];
+    std::vector<uint64_t> counts;
+    for (const auto& entry : table1) {
+      uint64_t chosen = chosenMask(entry.first, bagSize);
+      auto foundIter = byChosen.find(chosen);
+      if (foundIter == byChosen.end()) {
+        continue;
+      }
+      size_t nofChosen = 0;
+      for (size_t pos = 0; pos < bagSize; ++pos) {
+        nofChosen += (chosen >> pos) & 1;
+      }
+      for (const auto& other : foundIter->second) {
+        if ((entry.first & DONE) && (other.first & DONE)) {
+          continue;
+        }
+        bool done = ((entry.first | other.first) & DONE) != 0;
+        // merge the components of both partial solutions
+        for (size_t pos = 0; pos < bagSize; ++pos) {
+          labels[pos] = (chosen >> pos) & 1 ? static_cast<unsigned>(pos + 1) : 0;
+        }
+        for (size_t pos = 0; pos < bagSize; ++pos) {
+          for (size_t otherPos = pos + 1; otherPos < bagSize; ++otherPos) {
+            if (labels[pos] != 0 && labels[otherPos] != 0
+                && labels[pos] != labels[otherPos]
+                && ((getLabel(entry.first, pos) == getLabel(entry.first, otherPos))
+                    || (getLabel(other.first, pos) == getLabel(other.first, otherPos)))) {
+              unsigned from = labels[otherPos];
+              for (size_t idx = 0; idx < bagSize; ++idx) {
+                if (labels[idx] == from) {
+                  labels[idx] = labels[pos];
+                }
+              }
+            }
+          }
+        }
+        const std::vector<uint64_t>& counts1 = entry.second;
+        const std::vector<uint64_t>& counts2 = *other.second;
+        counts.assign(m_limit + 1, 0);
+        for (size_t size1 = nofChosen; size1 < counts1.size(); ++size1) {
+          if (counts1[size1] == 0) {
+            continue;
+          }
+          for (size_t size2 = nofChosen; size2 < counts2.size() && size1 + size2 - nofChosen <= m_limit; ++size2) {
+            counts[size1 + size2 - nofChosen] += counts1[size1] * counts2[size2];
+          }
+        }
+        addCounts(result, encode(labels, bagSize, done), counts, 0);
+      }
+    }
+    return result;
+  }
+
+  static uint64_t chosenMask(uint64_t state, size_t bagSize)
+  {
+    uint64_t mask = 0;
+    for (size_t pos = 0; pos < bagSize; ++pos) {
+      if (getLabel(state, pos) != 0) {
+        mask |= uint64_t(1) << pos;
+      }
+    }
+    return mask;
+  }
+
+  const CsrGraph<uint32_t>& m_graph;
+  size_t m_limit;
+};
+
+/**
+ * @brief Visitor counting the emitted subgraphs per size.
+ */
+struct SizeCounter : public EnumerationVisitor
+{
+  template<typename Node>
+  void emit(const std::vector<Node>& subgraph)
+  {
+    ++counts[subgraph.size()];
+  }
+
+  std::vector<size_t> counts;
+};
+
+/**
+ * @brief Count the connected induced subgraphs of an index graph per size.
+ *
+ * @param graph The index graph.
+ * @param upper Upper bound for the size of the subgraphs.
+ * @param maxWidth Maximum width of the tree decomposition used for counting.
+ *
+ * If the minimum degree heuristic finds a tree decomposition of width at most 'maxWidth',
+ * the subgraphs are counted by dynamic programming over the decomposition in time polynomial
+ * in the number of nodes and exponential only in the width. Otherwise they are enumerated.
+ */
+inline std::vector<size_t> countSubgraphs(
+    const CsrGraph<uint32_t>& graph,
+    size_t upper,
+    size_t maxWidth)
+{
+  size_t limit = std::min(upper, graph.nofNodes());
+  maxWidth = std::min(maxWidth, DecompositionCounter::MAX_BAG_SIZE - 1);
+  TreeDecomposition decomposition;
+  if (decomposeGraph(graph, maxWidth, decomposition)) {
+    DecompositionCounter counter(graph, limit);
+    return counter.count(decomposition);
+  }
+  SizeCounter counter;
+  counter.counts.assign(limit + 1, 0);
+  visitEnumeration<CsrGraph<uint32_t>, uint32_t>(graph, limit, NoFilter(), counter, std::less<uint32_t>());
+  return counter.counts;
+}
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Iterator over a contiguous range of integral values without a backing container.
+ *
+ * @tparam Index Type of the integral values.
+ *
+ * Used as node iterator for graphs whose nodes are the indices 0, ..., n-1.
+ */
+template<typename Index>
+class CountingIterator
+{
+public:
+
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = Index;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const Index*;
+  using reference = Index;
+
+  CountingIterator()
+    : m_value(0) {}
+
+  explicit CountingIterator(Index value)
+    : m_value(value) {}
+
+  Index operator*() const
+  {
+    return m_value;
+  }
+
+  CountingIterator& operator++()
+  {
+    ++m_value;
+    return *this;
+  }
+
+  CountingIterator operator++(int)
+  {
+    CountingIterator copy(*this);
+    ++m_value;
+    return copy;
+  }
+
+  bool operator==(const CountingIterator& other) const
+  {
+    return m_value == other.m_value;
+  }
+
+  bool operator!=(const CountingIterator& other) const
+  {
+    return m_value != other.m_value;
+  }
+
+private:
+
+  Index m_value;
+};
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -1,15 +1,170 @@
 #pragma once
 
 #include <algorithm>
+#include <type_traits>
 #include <vector>
 
 #include "../GraphTraits.hpp"
 #include "../Types.hpp"
+#include "IndexedEnumeration.hpp"
+#include "TraitHooks.hpp"
 
 namespace ConsensLib {
 
 namespace Intern {
 
+/**
+ * @brief Compute the candidates and forbidden nodes of the subgraph extended by one candidate
+ *        using linear time set operations on the sorted adjacency lists.
+ *
+ * @param graph The input graph
+ * @param current Currently considered subgraph, already containing the chosen candidate.
+ * @param candidates Candidates of the subgraph without the chosen candidate.
+ * @param candidateIter Position of the chosen candidate in 'candidates'.
+ * @param forbidden Forbidden nodes of the subgraph without the chosen candidate.
+ * @param nextCandidates Output for the candidates of the extended subgraph.
+ * @param nextForbidden Output for the forbidden nodes of the extended subgraph.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+void updateSetsLinear(
+    const Graph& graph,
+    const std::vector<Node>& current,
+    const std::vector<Node>& candidates,
+    typename std::vector<Node>::const_iterator candidateIter,
+    const std::vector<Node>& forbidden,
+    std::vector<Node>& nextCandidates,
+    std::vector<Node>& nextForbidden,
+    const Compare& compare)
+{
+  std::set_union(candidates.begin(), candidateIter,
+                 forbidden.begin(), forbidden.end(),
+                 std::back_inserter(nextForbidden), compare);
+  std::vector<Node> tempComplement;
+  auto begin = GraphTraits<Graph>::adjancencyBegin(*candidateIter, graph);
+  auto end = GraphTraits<Graph>::adjancencyEnd(*candidateIter, graph);
+  std::set_difference(begin, end,
+                      current.begin(), current.end(),
+                      std::back_inserter(tempComplement), compare);
+  std::vector<Node> complement;
+  std::set_difference(tempComplement.begin(), tempComplement.end(),
+                      nextForbidden.begin(), nextForbidden.end(),
+                      std::back_inserter(complement), compare);
+  std::set_union(candidateIter + 1, candidates.end(),
+                 complement.begin(), complement.end(),
+                 std::back_inserter(nextCandidates), compare);
+}
+
+/**
+ * @brief Compute the candidates and forbidden nodes of the subgraph extended by one candidate
+ *        with binary searches, which does not require sorted adjacency lists.
+ *
+ * Same parameters as \ref updateSetsLinear.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+void updateSetsNonLinear(
+    const Graph& graph,
+    const std::vector<Node>& current,
+    const std::vector<Node>& candidates,
+    typename std::vector<Node>::const_iterator candidateIter,
+    const std::vector<Node>& forbidden,
+    std::vector<Node>& nextCandidates,
+    std::vector<Node>& nextForbidden,
+    const Compare& compare)
+{
+  nextCandidates.assign(candidateIter + 1, candidates.end());
+  std::set_union(forbidden.begin(), forbidden.end(),
+                 candidates.begin(), candidateIter,
+                 std::back_inserter(nextForbidden), compare);
+  auto begin = GraphTraits<Graph>::adjancencyBegin(*candidateIter, graph);
+  auto end = GraphTraits<Graph>::adjancencyEnd(*candidateIter, graph);
+  for (auto neighborIter = begin; neighborIter != end; ++ neighborIter) {
+    auto foundIter = std::lower_bound(nextForbidden.begin(), nextForbidden.end(), *neighborIter, compare);
+    if (foundIter != nextForbidden.end() && !compare(*neighborIter, *foundIter)) {
+      continue;
+    }
+    auto currentIter = std::lower_bound(current.begin(), current.end(), *neighborIter, compare);
+    if (currentIter != current.end()
+        && !compare(*currentIter, *neighborIter)
+        && !compare(*neighborIter, *currentIter)) {
+      continue;
+    }
+    auto insertIter = std::lower_bound(nextCandidates.begin(), nextCandidates.end(), *neighborIter, compare);
+    if (insertIter == nextCandidates.end() || compare(*neighborIter, *insertIter)) {
+      nextCandidates.insert(insertIter, *neighborIter);
+    }
+  }
+}
+
+/**
+ * @brief Compute the candidates and forbidden nodes of the subgraph extended by one candidate.
+ *        Depending on wether or not the adjacency lists are sorted a diferent function is called.
+ *
+ * Same parameters as \ref updateSetsLinear.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+void updateSets(
+    const Graph& graph,
+    const std::vector<Node>& current,
+    const std::vector<Node>& candidates,
+    typename std::vector<Node>::const_iterator candidateIter,
+    const std::vector<Node>& forbidden,
+    std::vector<Node>& nextCandidates,
+    std::vector<Node>& nextForbidden,
+    const Compare& compare)
+{
+  if (GraphTraits<Graph>::listsSorted()) {
+    updateSetsLinear(graph, current, candidates, candidateIter, forbidden, nextCandidates, nextForbidden, compare);
+  }
+  else {
+    updateSetsNonLinear(graph, current, candidates, candidateIter, forbidden, nextCandidates, nextForbidden, compare);
+  }
+}
+
+/**
+ * @brief Compute the candidates and forbidden nodes of the subgraph consisting of a single root node.
+ *
+ * @param graph The input graph
+ * @param nodesVector All nodes of the graph sorted by 'compare'.
+ * @param rootIter Position of the root in 'nodesVector'.
+ * @param candidates Output for the neighbors of the root that are larger than the root.
+ * @param forbidden Output for all nodes smaller than the root.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+void getRootSets(
+    const Graph& graph,
+    const std::vector<Node>& nodesVector,
+    typename std::vector<Node>::const_iterator rootIter,
+    std::vector<Node>& candidates,
+    std::vector<Node>& forbidden,
+    const Compare& compare)
+{
+  forbidden.assign(nodesVector.begin(), rootIter);
+  auto begin = GraphTraits<Graph>::adjancencyBegin(*rootIter, graph);
+  auto end = GraphTraits<Graph>::adjancencyEnd(*rootIter, graph);
+  if (GraphTraits<Graph>::listsSorted()) {
+    std::set_difference(begin, end, forbidden.begin(), forbidden.end(), std::back_inserter(candidates), compare);
+  }
+  else {
+    for (auto neighborIter = begin; neighborIter != end; ++neighborIter) {
+      auto foundIter = std::lower_bound(forbidden.begin(), forbidden.end(), *neighborIter, compare);
+      if (foundIter == forbidden.end() || compare(*neighborIter, *foundIter)) {
+        candidates.push_back(*neighborIter);
+      }
+    }
+    std::sort(candidates.begin(), candidates.end(), compare);
+  }
+}
+
 /**
  * @brief Perform a recursive call for adding a subgraph together with all its super graphs
  *        following the restriction defined by the forbidden nodes.
@@ -18,6 +173,7 @@ namespace Intern {
  * @tparam Node Type of node contained in the graph.
  * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
  * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the enumeration events.
  *
  * @param graph The input graph
  * @param upper Optional upper bound for the size of the subgraphs.
@@ -26,21 +182,22 @@ namespace Intern {
  * @param current Currently considered subgraph.
  * @param candidates Neighboring nodes that can be added to the subgraph.
  * @param forbidden Forbidden nodes that can never be added to this subgraph.
- * @param subgraphs the output container for all connected induced subgraphs
- *        that fulfill the filter criteria.
+ * @param visitor Receives the push, pop and emit events of the enumeration.
+ *        Every subgraph that fulfills the filter criteria is emitted.
  * @param compare The compare function defining a strict total ordering on the nodes of the graph.
  *
- * Adds the currently considered subgraph to the output container if it fulfills the filter criteria.
- * For each candidate node the set of forbidden nodes is updated by adding all candidates
- * that are smaller than the chosen candidate itself. The candidate set is updated by excluding
- * all newly added forbidden nodes and adding neighbors of the currently considered candidate
- * that are not forbidden. All these operations can be done in asymptotic linear time with respect
- * to the number of nodes contained in the input graph.
+ * Emits the currently considered subgraph to the visitor if it fulfills the filter criteria.
+ * If the visitor agrees to expand the subgraph, then for each candidate node the set of forbidden
+ * nodes is updated by adding all candidates that are smaller than the chosen candidate itself.
+ * The candidate set is updated by excluding all newly added forbidden nodes and adding
+ * neighbors of the currently considered candidate that are not forbidden. All these operations
+ * can be done in asymptotic linear time with respect to the number of nodes contained in the input graph.
  */
 template<typename Graph,
          typename Node,
          typename FilterFunc,
-         typename Compare>
+         typename Compare,
+         typename Visitor>
 void generateRecursiveLinear(
     const Graph& graph,
     size_t upper,
@@ -48,37 +205,24 @@ void generateRecursiveLinear(
     std::vector<Node>& current,
     const std::vector<Node>& candidates,
     const std::vector<Node>& forbidden,
-    std::vector<std::vector<Node>>& subgraphs,
+    Visitor& visitor,
     const Compare& compare)
 {
   if (filter(current)) {
-    subgraphs.push_back(current);
+    visitor.emit(current);
   }
-  if (current.size() < upper) {
+  if (current.size() < upper && visitor.expand(current, candidates)) {
     for (auto candidateIter = candidates.begin(); candidateIter != candidates.end(); ++candidateIter) {
       auto subgraphIter = std::lower_bound(current.begin(), current.end(), *candidateIter, compare);
       current.insert(subgraphIter, *candidateIter);
-      std::vector<Node> nextForbidden;
-      std::set_union(candidates.begin(), candidateIter,
-                     forbidden.begin(), forbidden.end(),
-                     std::back_inserter(nextForbidden), compare);
-      std::vector<Node> tempComplement;
-      auto begin = GraphTraits<Graph>::adjancencyBegin(*candidateIter, graph);
-      auto end = GraphTraits<Graph>::adjancencyEnd(*candidateIter, graph);
-      std::set_difference(begin, end,
-                          current.begin(), current.end(),
-                          std::back_inserter(tempComplement), compare);
-      std::vector<Node> complement;
-      std::set_difference(tempComplement.begin(), tempComplement.end(),
-                          nextForbidden.begin(), nextForbidden.end(),
-                          std::back_inserter(complement), compare);
+      visitor.push(*candidateIter);
       std::vector<Node> nextCandidates;
-      std::set_union(candidateIter + 1, candidates.end(),
-                     complement.begin(), complement.end(),
-                     std::back_inserter(nextCandidates), compare);
-      generateRecursiveLinear(graph, upper, filter, current, nextCandidates, nextForbidden, subgraphs, compare);
+      std::vector<Node> nextForbidden;
+      updateSetsLinear(graph, current, candidates, candidateIter, forbidden, nextCandidates, nextForbidden, compare);
+      generateRecursiveLinear(graph, upper, filter, current, nextCandidates, nextForbidden, visitor, compare);
       auto eraseIter = std::lower_bound(current.begin(), current.end(), *candidateIter, compare);
       current.erase(eraseIter);
+      visitor.pop(*candidateIter);
     }
   }
 }
@@ -91,6 +235,7 @@ void generateRecursiveLinear(
  * @tparam Node Type of node contained in the graph.
  * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
  * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the enumeration events.
  *
  * @param graph The input graph
  * @param upper Optional upper bound for the size of the subgraphs.
@@ -99,21 +244,23 @@ void generateRecursiveLinear(
  * @param current Currently considered subgraph.
  * @param candidates Neighboring nodes that can be added to the subgraph.
  * @param forbidden Forbidden nodes that can never be added to this subgraph.
- * @param subgraphs the output container for all connected induced subgraphs
- *        that fulfill the filter criteria.
+ * @param visitor Receives the push, pop and emit events of the enumeration.
+ *        Every subgraph that fulfills the filter criteria is emitted.
  * @param compare The compare function defining a strict total ordering on the nodes of the graph.
  *
- * Adds the currently considered subgraph to the output container if it fulfills the filter criteria.
- * For each candidate node the set of forbidden nodes is updated by adding all candidates
- * that are smaller than the chosen candidate itself. The candidate set is updated by excluding
- * all newly added forbidden nodes and adding neighbors of the currently considered candidate
- * that are not forbidden. The update of the candidate set has worst-case time complexity O(n log n)
- * where n is the number of nodes contained in the query graph.
+ * Emits the currently considered subgraph to the visitor if it fulfills the filter criteria.
+ * If the visitor agrees to expand the subgraph, then for each candidate node the set of forbidden
+ * nodes is updated by adding all candidates that are smaller than the chosen candidate itself.
+ * The candidate set is updated by excluding all newly added forbidden nodes and adding
+ * neighbors of the currently considered candidate that are not forbidden. The update of the
+ * candidate set has worst-case time complexity O(n log n) where n is the number of nodes
+ * contained in the query graph.
  */
 template<typename Graph,
          typename Node,
          typename FilterFunc,
-         typename Compare>
+         typename Compare,
+         typename Visitor>
 void generateRecursiveNonLinear(
     const Graph& graph,
     size_t upper,
@@ -121,107 +268,213 @@ void generateRecursiveNonLinear(
     std::vector<Node>& current,
     const std::vector<Node>& candidates,
     const std::vector<Node>& forbidden,
-    std::vector<std::vector<Node>>& subgraphs,
+    Visitor& visitor,
     const Compare& compare)
 {
   if (filter(current)) {
-    subgraphs.push_back(current);
+    visitor.emit(current);
   }
-  if (current.size() < upper) {
+  if (current.size() < upper && visitor.expand(current, candidates)) {
     for (auto candidateIter = candidates.begin(); candidateIter != candidates.end(); ++candidateIter) {
       auto subgraphIter = std::lower_bound(current.begin(), current.end(), *candidateIter, compare);
       current.insert(subgraphIter, *candidateIter);
-      std::vector<Node> nextCandidates(candidateIter + 1, candidates.end());
+      visitor.push(*candidateIter);
+      std::vector<Node> nextCandidates;
       std::vector<Node> nextForbidden;
-      std::set_union(forbidden.begin(), forbidden.end(),
-                     candidates.begin(), candidateIter,
-                     std::back_inserter(nextForbidden), compare);
-      auto begin = GraphTraits<Graph>::adjancencyBegin(*candidateIter, graph);
-      auto end = GraphTraits<Graph>::adjancencyEnd(*candidateIter, graph);
-      for (auto neighborIter = begin; neighborIter != end; ++ neighborIter) {
-        auto foundIter = std::lower_bound(nextForbidden.begin(), nextForbidden.end(), *neighborIter, compare);
-        if (foundIter != nextForbidden.end() && !compare(*neighborIter, *foundIter)) {
-          continue;
-        }
-        auto currentIter = std::lower_bound(current.begin(), current.end(), *neighborIter, compare);
-        if (currentIter != current.end()
-            && !compare(*currentIter, *neighborIter)
-            && !compare(*neighborIter, *currentIter)) {
-          continue;
-        }
-        auto insertIter = std::lower_bound(nextCandidates.begin(), nextCandidates.end(), *neighborIter, compare);
-        if (insertIter == nextCandidates.end() || compare(*neighborIter, *insertIter)) {
-          nextCandidates.insert(insertIter, *neighborIter);
-        }
-      }
-      generateRecursiveNonLinear(graph,upper, filter, current, nextCandidates, nextForbidden, subgraphs, compare);
+      updateSetsNonLinear(graph, current, candidates, candidateIter, forbidden, nextCandidates, nextForbidden, compare);
+      generateRecursiveNonLinear(graph, upper, filter, current, nextCandidates, nextForbidden, visitor, compare);
       auto eraseIter = std::lower_bound(current.begin(), current.end(), *candidateIter, compare);
       current.erase(eraseIter);
+      visitor.pop(*candidateIter);
+    }
+  }
+}
+
+/**
+ * @brief Visitor collecting every emitted subgraph in an output container.
+ *
+ * @tparam Node Type of node contained in the graph.
+ */
+template<typename Node>
+struct SubgraphCollector : public EnumerationVisitor
+{
+  void emit(const std::vector<Node>& subgraph)
+  {
+    subgraphs.push_back(subgraph);
+  }
+
+  std::vector<std::vector<Node>> subgraphs;
+};
+
+/**
+ * @brief Enumeration on sorted node sets, used if the traits do not provide the 'index' hook.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the enumeration events.
+ *
+ * @param graph The input graph
+ * @param nodesVector All nodes of the graph sorted by 'compare'; every node is a root in this order.
+ * @param upper Upper bound for the size of the subgraphs.
+ * @param filter Filter criteria applied to the subgraphs.
+ *        Must accept std::vector<Node> as input and return a boolean.
+ * @param visitor Receives the push, pop and emit events of the enumeration.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ *
+ * Computes the candidates and forbidden nodes of every root with \ref getRootSets and runs
+ * \ref generateRecursiveLinear if the adjacency lists are sorted, otherwise
+ * \ref generateRecursiveNonLinear.
+ */
+template<typename Graph,
+         typename Node,
+         typename FilterFunc,
+         typename Compare,
+         typename Visitor>
+void visitEnumeration(
+    const Graph& graph,
+    const std::vector<Node>& nodesVector,
+    size_t upper,
+    const FilterFunc& filter,
+    Visitor& visitor,
+    const Compare& compare,
+    std::false_type)
+{
+  for (auto iter = nodesVector.cbegin(); iter != nodesVector.cend(); ++iter) {
+    std::vector<Node> current({*iter});
+    std::vector<Node> candidates;
+    std::vector<Node> forbidden;
+    getRootSets(graph, nodesVector, iter, candidates, forbidden, compare);
+    visitor.push(*iter);
+    if (GraphTraits<Graph>::listsSorted()) {
+      generateRecursiveLinear(graph, upper, filter, current, candidates, forbidden, visitor, compare);
+    }
+    else {
+      generateRecursiveNonLinear(graph, upper, filter, current, candidates, forbidden, visitor, compare);
     }
+    visitor.pop(*iter);
   }
 }
 
 /**
- * @brief Perform the actual enumeration of subgraphs. Depending on wether or not the adjacency lists
+ * @brief Enumeration on dense node states, used if the traits provide the 'index' and
+ *        'nodeCount' hooks.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the enumeration events.
+ *
+ * @param graph The input graph
+ * @param nodesVector All nodes of the graph sorted by 'compare'; every node is a root in this order.
+ * @param upper Upper bound for the size of the subgraphs.
+ * @param filter Filter criteria applied to the subgraphs.
+ *        Must accept std::vector<Node> as input and return a boolean.
+ * @param visitor Receives the push, pop and emit events of the enumeration.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ *
+ * Runs one \ref IndexedGenerator from every root, which reuses its state arrays indexed by the
+ * hook for all roots instead of building sorted sets per recursion step.
+ */
+template<typename Graph,
+         typename Node,
+         typename FilterFunc,
+         typename Compare,
+         typename Visitor>
+void visitEnumeration(
+    const Graph& graph,
+    const std::vector<Node>& nodesVector,
+    size_t upper,
+    const FilterFunc& filter,
+    Visitor& visitor,
+    const Compare& compare,
+    std::true_type)
+{
+  IndexedGenerator<Graph, Node, Compare> generator(graph, nodesVector, compare);
+  for (const Node& root : nodesVector) {
+    generator.run(root, upper, filter, visitor);
+  }
+}
+
+/**
+ * @brief Perform the actual enumeration of subgraphs and report it to a visitor.
+ *        Depending on the optional hooks of the traits and on wether or not the adjacency lists
  *        are sorted a diferent function is called
  *
  * @tparam Graph Type of graph for enumeration.
  * @tparam Node Type of node contained in the graph.
  * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
  * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the enumeration events.
  *
  * @param graph The input graph
  * @param upper Optional upper bound for the size of the subgraphs.
  * @param filter Optional filter criteria applied to the subgraphs.
  *        Must accept std::vector<Node> as input and return a boolean.
+ * @param visitor Receives the push, pop and emit events of the enumeration.
  * @param compare The compare function defining a strict total ordering on the nodes of the graph.
  *
- * If all adjacency lists are sorted it is possible to apply set operations such as
- * 'union', 'intersection' and 'difference' in asymptotic linear time with respect to the number of
- * nodes contained in the query graph. When the adjacency lists are not sorted this is not possible
- * and the asymptotic runtime of one recursive call is O(n log n) where n is the number of nodes contained
- * in the query graph.
+ * If the traits provide the 'index' and 'nodeCount' hooks, the recursion keeps the state of the
+ * nodes in dense arrays, see \ref IndexedGenerator. Otherwise, if all adjacency lists are sorted
+ * it is possible to apply set operations such as 'union', 'intersection' and 'difference' in
+ * asymptotic linear time with respect to the number of nodes contained in the query graph.
+ * When the adjacency lists are not sorted this is not possible and the asymptotic runtime of one
+ * recursive call is O(n log n) where n is the number of nodes contained in the query graph.
+ * All variants report the same events in the same order.
  */
 template<typename Graph,
          typename Node,
          typename FilterFunc,
-         typename Compare>
-std::vector<std::vector<Node>> runEnumeration(
+         typename Compare,
+         typename Visitor>
+void visitEnumeration(
     const Graph& graph,
     size_t upper,
     const FilterFunc& filter,
+    Visitor& visitor,
     const Compare& compare)
 {
-  std::vector<std::vector<Node>> subgraphs;
   if (upper == 0) {
-    return subgraphs;
+    return;
   }
   auto nodesBegin = GraphTraits<Graph>::nodesBegin(graph);
   auto nodesEnd = GraphTraits<Graph>::nodesEnd(graph);
   std::vector<Node> nodesVector(nodesBegin, nodesEnd);
   std::sort(nodesVector.begin(), nodesVector.end(), compare);
-  for (auto iter = nodesVector.begin(); iter != nodesVector.end(); ++iter) {
-    std::vector<Node> current({*iter});
-    std::vector<Node> candidates;
-    std::vector<Node> forbidden(nodesVector.begin(), iter);
-    auto begin = GraphTraits<Graph>::adjancencyBegin(*iter, graph);
-    auto end = GraphTraits<Graph>::adjancencyEnd(*iter, graph);
-    if (GraphTraits<Graph>::listsSorted()) {
-      std::set_difference(begin, end, forbidden.begin(), forbidden.end(), std::back_inserter(candidates), compare);
-      generateRecursiveLinear(graph, upper, filter, current, candidates, forbidden, subgraphs, compare);
-    }
-    else {
-      for (auto neighborIter = begin; neighborIter != end; ++neighborIter) {
-        auto foundIter = std::lower_bound(forbidden.begin(), forbidden.end(), *neighborIter, compare);
-        if (foundIter == forbidden.end() || compare(*neighborIter, *foundIter)) {
-          candidates.push_back(*neighborIter);
-        }
-      }
-      std::sort(candidates.begin(), candidates.end(), compare);
-      generateRecursiveNonLinear(graph, upper, filter, current, candidates, forbidden, subgraphs, compare);
-    }
-  }
-  return subgraphs;
+  visitEnumeration(graph, nodesVector, upper, filter, visitor, compare, HasIndexHook<Graph>());
+}
+
+/**
+ * @brief Perform the actual enumeration of subgraphs and collect all of them.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph The input graph
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the subgraphs.
+ *        Must accept std::vector<Node> as input and return a boolean.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ *
+ * See \ref visitEnumeration for details.
+ */
+template<typename Graph,
+         typename Node,
+         typename FilterFunc,
+         typename Compare>
+std::vector<std::vector<Node>> runEnumeration(
+    const Graph& graph,
+    size_t upper,
+    const FilterFunc& filter,
+    const Compare& compare)
+{
+  SubgraphCollector<Node> collector;
+  visitEnumeration<Graph, Node>(graph, upper, filter, collector, compare);
+  return std::move(collector.subgraphs);
 }
 
 } // end namespace Intern
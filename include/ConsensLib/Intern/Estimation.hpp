@@ -0,0 +1,249 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../GraphTraits.hpp"
+#include "Enumeration.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Estimated size and cost of an enumeration.
+ *
+ * @tparam Node Type of node contained in the graph.
+ *
+ * The intervals are approximate 95% confidence intervals of the estimated counts.
+ */
+template<typename Node>
+struct EnumerationEstimate
+{
+  std::vector<double> counts;      ///< estimated number of subgraphs per number of nodes
+  std::vector<double> lowerCounts; ///< lower end of the confidence interval per number of nodes
+  std::vector<double> upperCounts; ///< upper end of the confidence interval per number of nodes
+  double total = 0;                ///< estimated number of subgraphs
+  double lowerTotal = 0;           ///< lower end of the confidence interval of the total
+  double upperTotal = 0;           ///< upper end of the confidence interval of the total
+  double seconds = 0;              ///< estimated run-time of the enumeration without filter
+  std::vector<Node> roots;         ///< all nodes sorted by the compare function
+  std::vector<double> rootCounts;  ///< estimated number of subgraphs whose smallest node is the root
+  size_t nofProbes = 0;            ///< number of random probes performed
+};
+
+namespace Intern {
+
+/**
+ * @brief Logarithm of the number of subsets with at most 'maxSize' elements of a set with 'size' elements.
+ */
+inline double logBoundedSubsets(
+    size_t size,
+    size_t maxSize)
+{
+  if (maxSize >= size) {
+    return size * std::log(2.0);
+  }
+  double logBinomial = 0;
+  double logSum = 0;
+  for (size_t k = 1; k <= maxSize; ++k) {
+    logBinomial += std::log(static_cast<double>(size - k + 1)) - std::log(static_cast<double>(k));
+    double larger = std::max(logSum, logBinomial);
+    logSum = larger + std::log1p(std::exp(std::min(logSum, logBinomial) - larger));
+  }
+  return logSum;
+}
+
+/**
+ * @brief Follow a single random path from a root through the recursion of the enumeration.
+ *
+ * @param graph The input graph
+ * @param upper Upper bound for the size of the subgraphs.
+ * @param nodesVector All nodes of the graph sorted by 'compare'.
+ * @param rootIter Position of the root of the path in 'nodesVector'.
+ * @param generator Source of randomness choosing the candidate in each frame.
+ * @param estimate Output receiving the estimated number of subgraphs per size below the root.
+ *        Must have one entry per size and be zero initialized.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ *
+ * @return Number of root frames and candidate set updates performed by the probe, which are
+ *         the same operations the enumeration performs once per subgraph.
+ *
+ * Knuth's estimator with importance sampling: in each frame the sets of all children are computed
+ * and a child is chosen with probability proportional to the number of subsets of its candidates
+ * that respect the upper bound, which approximates the size of its subtree. Every frame on the path
+ * stands for as many frames of its level as the product of the inverse probabilities of the choices,
+ * which keeps the estimate unbiased while avoiding the high variance of uniform choices on the
+ * recursion of CONSENS, where early candidates own much larger subtrees than late ones.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+size_t probeRecursion(
+    const Graph& graph,
+    size_t upper,
+    const std::vector<Node>& nodesVector,
+    typename std::vector<Node>::const_iterator rootIter,
+    std::mt19937_64& generator,
+    std::vector<double>& estimate,
+    const Compare& compare)
+{
+  std::vector<Node> current({*rootIter});
+  std::vector<Node> candidates;
+  std::vector<Node> forbidden;
+  getRootSets(graph, nodesVector, rootIter, candidates, forbidden, compare);
+  double weight = 1;
+  size_t nofFrames = 1;
+  estimate[1] += weight;
+  std::vector<std::vector<Node>> childCandidates;
+  std::vector<std::vector<Node>> childForbidden;
+  std::vector<double> childWeights;
+  while (current.size() < upper && !candidates.empty()) {
+    childCandidates.assign(candidates.size(), std::vector<Node>());
+    childForbidden.assign(candidates.size(), std::vector<Node>());
+    childWeights.assign(candidates.size(), 0);
+    for (auto candidateIter = candidates.cbegin(); candidateIter != candidates.cend(); ++candidateIter) {
+      size_t pos = candidateIter - candidates.cbegin();
+      auto subgraphIter = std::lower_bound(current.begin(), current.end(), *candidateIter, compare);
+      subgraphIter = current.insert(subgraphIter, *candidateIter);
+      updateSets(graph, current, candidates, candidateIter, forbidden, childCandidates[pos], childForbidden[pos], compare);
+      current.erase(subgraphIter);
+      ++nofFrames;
+      childWeights[pos] = logBoundedSubsets(childCandidates[pos].size(), upper - current.size() - 1);
+    }
+    double maxWeight = *std::max_element(childWeights.begin(), childWeights.end());
+    double weightSum = 0;
+    for (double& childWeight : childWeights) {
+      childWeight = std::exp(childWeight - maxWeight);
+      weightSum += childWeight;
+    }
+    std::uniform_real_distribution<double> distribution(0, weightSum);
+    double choice = distribution(generator);
+    size_t pos = 0;
+    while (pos + 1 < candidates.size() && choice >= childWeights[pos]) {
+      choice -= childWeights[pos];
+      ++pos;
+    }
+    weight *= weightSum / childWeights[pos];
+    auto subgraphIter = std::lower_bound(current.begin(), current.end(), candidates[pos], compare);
+    current.insert(subgraphIter, candidates[pos]);
+    candidates.swap(childCandidates[pos]);
+    forbidden.swap(childForbidden[pos]);
+    estimate[current.size()] += weight;
+  }
+  return nofFrames;
+}
+
+/**
+ * @brief Estimate the number of subgraphs per size and the run-time of the enumeration
+ *        by random probes through its recursion.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph The input graph
+ * @param upper Upper bound for the size of the subgraphs.
+ * @param nofProbes Number of random probes.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ * @param seed Seed of the random choices.
+ *
+ * The probes are distributed round-robin over the roots in random order, so every root is
+ * probed equally often up to one probe. Each probe multiplied by the number of roots is an
+ * unbiased estimate of the whole enumeration, and the confidence intervals are derived from the
+ * sample variance of these estimates. They are conservative as they ignore the stratification
+ * by roots. The run-time is extrapolated from the time the probes took per update of the
+ * candidate sets, which the enumeration performs once per subgraph.
+ * Roots without a probe are assigned the mean of the probed roots in 'rootCounts'.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+EnumerationEstimate<Node> estimateEnumeration(
+    const Graph& graph,
+    size_t upper,
+    size_t nofProbes,
+    const Compare& compare,
+    unsigned seed)
+{
+  EnumerationEstimate<Node> result;
+  result.roots.assign(GraphTraits<Graph>::nodesBegin(graph), GraphTraits<Graph>::nodesEnd(graph));
+  std::sort(result.roots.begin(), result.roots.end(), compare);
+  size_t nofNodes = result.roots.size();
+  size_t length = std::min(upper, nofNodes) + 1;
+  result.counts.assign(length, 0);
+  result.lowerCounts.assign(length, 0);
+  result.upperCounts.assign(length, 0);
+  result.rootCounts.assign(nofNodes, 0);
+  if (length == 1 || nofProbes == 0) {
+    return result;
+  }
+  result.nofProbes = nofProbes;
+
+  std::mt19937_64 generator(seed);
+  std::vector<size_t> rootOrder(nofNodes);
+  std::iota(rootOrder.begin(), rootOrder.end(), 0);
+  std::shuffle(rootOrder.begin(), rootOrder.end(), generator);
+
+  std::vector<double> sums(length + 1, 0);
+  std::vector<double> squareSums(length + 1, 0);
+  std::vector<size_t> rootProbes(nofNodes, 0);
+  std::vector<double> estimate(length);
+  size_t nofFrames = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t probe = 0; probe < nofProbes; ++probe) {
+    size_t root = rootOrder[probe % nofNodes];
+    std::fill(estimate.begin(), estimate.end(), 0);
+    nofFrames += probeRecursion(graph, upper, result.roots, result.roots.cbegin() + root,
+                                generator, estimate, compare);
+    double total = 0;
+    for (size_t size = 1; size < length; ++size) {
+      double value = estimate[size] * nofNodes;
+      sums[size] += value;
+      squareSums[size] += value * value;
+      total += estimate[size];
+    }
+    sums[length] += total * nofNodes;
+    squareSums[length] += total * nofNodes * total * nofNodes;
+    result.rootCounts[root] += total;
+    ++rootProbes[root];
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  auto interval = [nofProbes](double sum, double squareSum, double& mean, double& lower, double& upperEnd) {
+    mean = sum / nofProbes;
+    double variance = 0;
+    if (nofProbes > 1) {
+      variance = std::max(0.0, (squareSum - sum * mean) / (nofProbes - 1));
+    }
+    double halfWidth = 1.96 * std::sqrt(variance / nofProbes);
+    lower = std::max(0.0, mean - halfWidth);
+    upperEnd = mean + halfWidth;
+  };
+  for (size_t size = 1; size < length; ++size) {
+    interval(sums[size], squareSums[size], result.counts[size], result.lowerCounts[size], result.upperCounts[size]);
+  }
+  interval(sums[length], squareSums[length], result.total, result.lowerTotal, result.upperTotal);
+  result.seconds = elapsed.count() / nofFrames * result.total;
+
+  double probedSum = 0;
+  size_t nofProbedRoots = 0;
+  for (size_t root = 0; root < nofNodes; ++root) {
+    if (rootProbes[root] > 0) {
+      result.rootCounts[root] /= rootProbes[root];
+      probedSum += result.rootCounts[root];
+      ++nofProbedRoots;
+    }
+  }
+  for (size_t root = 0; root < nofNodes; ++root) {
+    if (rootProbes[root] == 0) {
+      result.rootCounts[root] = probedSum / nofProbedRoots;
+    }
+  }
+  return result;
+}
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Iterator over the elements of a range that fulfill a predicate, skipping all others on the fly.
+ *
+ * @tparam Iterator Type of the underlying iterator.
+ * @tparam Predicate Type of the predicate. Must accept the elements of the range and return a boolean.
+ *
+ * Used as node and adjacency iterator of graph views, so no filtered copy of the range is built.
+ * The predicate is referenced and must outlive the iterator.
+ */
+template<typename Iterator,
+         typename Predicate>
+class FilterIterator
+{
+public:
+
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = typename std::iterator_traits<Iterator>::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = typename std::iterator_traits<Iterator>::pointer;
+  using reference = typename std::iterator_traits<Iterator>::reference;
+
+  FilterIterator()
+    : m_predicate(nullptr) {}
+
+  FilterIterator(
+      Iterator current,
+      Iterator end,
+      const Predicate& predicate)
+    : m_current(current),
+      m_end(end),
+      m_predicate(&predicate)
+  {
+    skip();
+  }
+
+  reference operator*() const
+  {
+    return *m_current;
+  }
+
+  FilterIterator& operator++()
+  {
+    ++m_current;
+    skip();
+    return *this;
+  }
+
+  FilterIterator operator++(int)
+  {
+    FilterIterator copy(*this);
+    ++(*this);
+    return copy;
+  }
+
+  bool operator==(const FilterIterator& other) const
+  {
+    return m_current == other.m_current;
+  }
+
+  bool operator!=(const FilterIterator& other) const
+  {
+    return m_current != other.m_current;
+  }
+
+private:
+
+  void skip()
+  {
+    while (m_current != m_end && !(*m_predicate)(*m_current)) {
+      ++m_current;
+    }
+  }
+
+  Iterator m_current;
+  Iterator m_end;
+  const Predicate* m_predicate;
+};
+
+} // end namespace Intern
+} // end namespace ConsensLib
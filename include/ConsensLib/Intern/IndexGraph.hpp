@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "../CsrGraph.hpp"
+#include "../GraphTraits.hpp"
+#include "../Types.hpp"
+#include "TraitHooks.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Copy of an input graph relabeled to the indices 0, ..., n-1.
+ *
+ * @tparam Node Type of node contained in the input graph.
+ *
+ * 'nodes' maps every index to its node of the input graph.
+ */
+template<typename Node>
+struct IndexGraph
+{
+  std::vector<Node> nodes;
+  CsrGraph<uint32_t> graph;
+};
+
+/**
+ * @brief Position of a node in the nodes of a graph sorted by the compare function, found by binary search.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare,
+         bool hasIndex = HasIndexHook<Graph>::value>
+class NodePositions
+{
+public:
+
+  NodePositions(
+      const Graph& graph,
+      const std::vector<Node>& nodes,
+      const Compare& compare)
+    : m_nodes(nodes),
+      m_compare(compare) {}
+
+  uint32_t operator()(const Node& node) const
+  {
+    return static_cast<uint32_t>(std::lower_bound(m_nodes.begin(), m_nodes.end(), node, m_compare) - m_nodes.begin());
+  }
+
+private:
+
+  const std::vector<Node>& m_nodes;
+  const Compare& m_compare;
+};
+
+/**
+ * @brief Position of a node in the nodes of a graph sorted by the compare function, looked up
+ *        in an array by the 'index' hook of the traits.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+class NodePositions<Graph, Node, Compare, true>
+{
+public:
+
+  NodePositions(
+      const Graph& graph,
+      const std::vector<Node>& nodes,
+      const Compare& compare)
+    : m_graph(graph),
+      m_positions(GraphTraits<Graph>::nodeCount(graph))
+  {
+    for (size_t pos = 0; pos < nodes.size(); ++pos) {
+      m_positions[GraphTraits<Graph>::index(nodes[pos], graph)] = static_cast<uint32_t>(pos);
+    }
+  }
+
+  uint32_t operator()(const Node& node) const
+  {
+    return m_positions[GraphTraits<Graph>::index(node, m_graph)];
+  }
+
+private:
+
+  const Graph& m_graph;
+  std::vector<uint32_t> m_positions;
+};
+
+/**
+ * @brief Relabel the nodes of a graph to indices following the order defined by the compare function.
+ *
+ * @tparam Graph Type of the input graph.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph The input graph
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ *
+ * Every node is assigned its rank with respect to 'compare'. Each adjacency list is translated
+ * once with a binary search per entry, so the construction takes O(m log n) time, or with an
+ * array lookup per entry in O(n log n + m) time if the traits provide the 'index' hook.
+ * The indices are 32 bit, so the graph must have less than 2^32 nodes.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+IndexGraph<Node> buildIndexGraph(
+    const Graph& graph,
+    const Compare& compare)
+{
+  IndexGraph<Node> indexGraph;
+  indexGraph.nodes.assign(GraphTraits<Graph>::nodesBegin(graph), GraphTraits<Graph>::nodesEnd(graph));
+  std::vector<Node>& nodes = indexGraph.nodes;
+  assert(nodes.size() <= std::numeric_limits<uint32_t>::max());
+  std::sort(nodes.begin(), nodes.end(), compare);
+  NodePositions<Graph, Node, Compare> positions(graph, nodes, compare);
+  std::vector<size_t> offsets(nodes.size() + 1, 0);
+  std::vector<uint32_t> neighbors;
+  for (size_t idx = 0; idx < nodes.size(); ++idx) {
+    auto begin = GraphTraits<Graph>::adjancencyBegin(nodes[idx], graph);
+    auto end = GraphTraits<Graph>::adjancencyEnd(nodes[idx], graph);
+    for (auto iter = begin; iter != end; ++iter) {
+      neighbors.push_back(positions(*iter));
+    }
+    offsets[idx + 1] = neighbors.size();
+    if (!GraphTraits<Graph>::listsSorted()) {
+      std::sort(neighbors.begin() + offsets[idx], neighbors.end());
+    }
+  }
+  indexGraph.graph = CsrGraph<uint32_t>(std::move(offsets), std::move(neighbors));
+  return indexGraph;
+}
+
+/**
+ * @brief Map a node set given by indices back to the nodes of the input graph.
+ *
+ * The mapped nodes are sorted with respect to 'compare' like every subgraph
+ * generated directly on the input graph.
+ */
+template<typename Node,
+         typename Compare>
+void mapSubgraph(
+    const std::vector<uint32_t>& subgraph,
+    const std::vector<Node>& nodes,
+    std::vector<Node>& mapped,
+    const Compare& compare)
+{
+  mapped.clear();
+  for (uint32_t idx : subgraph) {
+    mapped.push_back(nodes[idx]);
+  }
+  std::sort(mapped.begin(), mapped.end(), compare);
+}
+
+/**
+ * @brief Visitor translating the events of an enumeration on an index graph
+ *        to the nodes of the input graph and forwarding them.
+ */
+template<typename Node,
+         typename Compare,
+         typename Visitor>
+class MappingVisitor : public EnumerationVisitor
+{
+public:
+
+  MappingVisitor(
+      const std::vector<Node>& nodes,
+      Visitor& visitor,
+      const Compare& compare)
+    : m_nodes(nodes),
+      m_visitor(visitor),
+      m_compare(compare) {}
+
+  void push(uint32_t idx)
+  {
+    m_visitor.push(m_nodes[idx]);
+  }
+
+  void pop(uint32_t idx)
+  {
+    m_visitor.pop(m_nodes[idx]);
+  }
+
+  void emit(const std::vector<uint32_t>& subgraph)
+  {
+    mapSubgraph(subgraph, m_nodes, m_mapped, m_compare);
+    m_visitor.emit(m_mapped);
+  }
+
+  /**
+   * The candidates are passed in the order they are processed by the enumeration on the index graph.
+   */
+  bool expand(
+      const std::vector<uint32_t>& current,
+      const std::vector<uint32_t>& candidates)
+  {
+    mapSubgraph(current, m_nodes, m_mapped, m_compare);
+    m_mappedCandidates.clear();
+    for (uint32_t idx : candidates) {
+      m_mappedCandidates.push_back(m_nodes[idx]);
+    }
+    return m_visitor.expand(m_mapped, m_mappedCandidates);
+  }
+
+private:
+
+  const std::vector<Node>& m_nodes;
+  Visitor& m_visitor;
+  const Compare& m_compare;
+  std::vector<Node> m_mapped;
+  std::vector<Node> m_mappedCandidates;
+};
+
+/**
+ * @brief Filter evaluating a filter of the input graph on node sets given by indices.
+ */
+template<typename Node,
+         typename FilterFunc,
+         typename Compare>
+class MappedFilter
+{
+public:
+
+  MappedFilter(
+      const std::vector<Node>& nodes,
+      const FilterFunc& filter,
+      const Compare& compare)
+    : m_nodes(nodes),
+      m_filter(filter),
+      m_compare(compare) {}
+
+  bool operator()(const std::vector<uint32_t>& subgraph) const
+  {
+    mapSubgraph(subgraph, m_nodes, m_mapped, m_compare);
+    return m_filter(m_mapped);
+  }
+
+private:
+
+  const std::vector<Node>& m_nodes;
+  const FilterFunc& m_filter;
+  const Compare& m_compare;
+  mutable std::vector<Node> m_mapped;
+};
+
+/**
+ * @brief The default filter accepts every node set without mapping it.
+ */
+template<typename Node,
+         typename Compare>
+class MappedFilter<Node, NoFilter, Compare> : public NoFilter
+{
+public:
+
+  MappedFilter(
+      const std::vector<Node>& nodes,
+      const NoFilter& filter,
+      const Compare& compare) {}
+};
+
+} // end namespace Intern
+} // end namespace ConsensLib
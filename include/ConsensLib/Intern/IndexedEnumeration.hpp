@@ -0,0 +1,183 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "../GraphTraits.hpp"
+#include "TraitHooks.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Recursion of CONSENS on dense arrays for graphs whose traits provide the 'index' and
+ *        'nodeCount' hooks.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * Instead of sorted candidate and forbidden sets, the state of every node (free, part of the current
+ * subgraph, candidate or forbidden) is kept in an array indexed by the hook, and the position of every
+ * node in the order of 'compare' in a second array. The nodes smaller than the root are recognized by
+ * their position, so they are never stored. Membership tests are therefore constant time and
+ * independent of whether the adjacency lists are sorted, and the candidates are still processed in
+ * the order of 'compare', so the visitor receives exactly the events of \ref visitEnumeration.
+ * The scratch buffers of each depth are kept over all roots and presized by the maximum degree
+ * if the traits provide it.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+class IndexedGenerator
+{
+public:
+
+  IndexedGenerator(
+      const Graph& graph,
+      const std::vector<Node>& nodesVector,
+      const Compare& compare)
+    : m_graph(graph),
+      m_compare(compare),
+      m_rank(GraphTraits<Graph>::nodeCount(graph), 0),
+      m_states(GraphTraits<Graph>::nodeCount(graph), FREE),
+      m_bufferSize(HasMaxDegreeHook<Graph>::value ? Intern::getMaxDegree(graph) : 0)
+  {
+    for (size_t pos = 0; pos < nodesVector.size(); ++pos) {
+      m_rank[index(nodesVector[pos])] = pos;
+    }
+  }
+
+  /**
+   * @brief Enumerate all subgraphs with smallest node 'root' and at most 'upper' nodes.
+   */
+  template<typename FilterFunc,
+           typename Visitor>
+  void run(
+      const Node& root,
+      size_t upper,
+      const FilterFunc& filter,
+      Visitor& visitor)
+  {
+    m_rootRank = m_rank[index(root)];
+    m_states[index(root)] = CURRENT;
+    std::vector<Node>& candidates = getBuffer(m_candidates, 0);
+    addCandidates(root, candidates);
+    std::vector<Node> current({root});
+    visitor.push(root);
+    generateRecursive(upper, filter, current, candidates, 0, visitor);
+    visitor.pop(root);
+    for (const Node& candidate : candidates) {
+      m_states[index(candidate)] = FREE;
+    }
+    m_states[index(root)] = FREE;
+  }
+
+private:
+
+  enum State : unsigned char {
+    FREE,
+    CURRENT,
+    CANDIDATE,
+    FORBIDDEN
+  };
+
+  size_t index(const Node& node) const
+  {
+    return GraphTraits<Graph>::index(node, m_graph);
+  }
+
+  bool rankLess(const Node& n1, const Node& n2) const
+  {
+    return m_rank[index(n1)] < m_rank[index(n2)];
+  }
+
+  std::vector<Node>& getBuffer(
+      std::deque<std::vector<Node>>& buffers,
+      size_t depth)
+  {
+    while (buffers.size() <= depth) {
+      buffers.emplace_back();
+      buffers.back().reserve(m_bufferSize);
+    }
+    buffers[depth].clear();
+    return buffers[depth];
+  }
+
+  /**
+   * @brief Append the free neighbors of 'node' larger than the root sorted by 'compare' and mark them as candidates.
+   */
+  void addCandidates(
+      const Node& node,
+      std::vector<Node>& added)
+  {
+    auto begin = GraphTraits<Graph>::adjancencyBegin(node, m_graph);
+    auto end = GraphTraits<Graph>::adjancencyEnd(node, m_graph);
+    for (auto iter = begin; iter != end; ++iter) {
+      size_t idx = index(*iter);
+      if (m_states[idx] == FREE && m_rank[idx] > m_rootRank) {
+        m_states[idx] = CANDIDATE;
+        added.push_back(*iter);
+      }
+    }
+    if (!GraphTraits<Graph>::listsSorted()) {
+      std::sort(added.begin(), added.end(), [this](const Node& n1, const Node& n2) { return rankLess(n1, n2); });
+    }
+  }
+
+  template<typename FilterFunc,
+           typename Visitor>
+  void generateRecursive(
+      size_t upper,
+      const FilterFunc& filter,
+      std::vector<Node>& current,
+      const std::vector<Node>& candidates,
+      size_t depth,
+      Visitor& visitor)
+  {
+    if (filter(current)) {
+      visitor.emit(current);
+    }
+    if (current.size() >= upper || !visitor.expand(current, candidates)) {
+      return;
+    }
+    for (auto candidateIter = candidates.begin(); candidateIter != candidates.end(); ++candidateIter) {
+      const Node& candidate = *candidateIter;
+      current.insert(std::lower_bound(current.begin(), current.end(), candidate, m_compare), candidate);
+      visitor.push(candidate);
+      m_states[index(candidate)] = CURRENT;
+
+      std::vector<Node>& added = getBuffer(m_added, depth);
+      addCandidates(candidate, added);
+      std::vector<Node>& nextCandidates = getBuffer(m_candidates, depth + 1);
+      std::merge(candidateIter + 1, candidates.end(), added.begin(), added.end(), std::back_inserter(nextCandidates),
+                 [this](const Node& n1, const Node& n2) { return rankLess(n1, n2); });
+      generateRecursive(upper, filter, current, nextCandidates, depth + 1, visitor);
+
+      for (const Node& node : m_added[depth]) {
+        m_states[index(node)] = FREE;
+      }
+      m_states[index(candidate)] = FORBIDDEN;
+      current.erase(std::lower_bound(current.begin(), current.end(), candidate, m_compare));
+      visitor.pop(candidate);
+    }
+    for (const Node& candidate : candidates) {
+      m_states[index(candidate)] = CANDIDATE;
+    }
+  }
+
+  const Graph& m_graph;
+  const Compare& m_compare;
+  std::vector<size_t> m_rank;
+  std::vector<State> m_states;
+  size_t m_bufferSize;
+  size_t m_rootRank = 0;
+  std::deque<std::vector<Node>> m_candidates;
+  std::deque<std::vector<Node>> m_added;
+};
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../CsrGraph.hpp"
+#include "../Types.hpp"
+#include "Enumeration.hpp"
+#include "IndexGraph.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Index of node sets of an index graph by ids, hashed by the XOR of random keys of their nodes.
+ *
+ * The hash of a set extended or reduced by a single node is its hash XOR the key of that node,
+ * so neighboring sets in the lattice are looked up in constant time plus the comparison of their nodes.
+ * All sets are stored consecutively; sets with equal hashes are chained by their ids.
+ */
+class SubsetIndex
+{
+public:
+
+  static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+  explicit SubsetIndex(size_t nofNodes)
+    : m_keys(nofNodes),
+      m_offsets(1, 0)
+  {
+    std::mt19937_64 generator(nofNodes);
+    for (uint64_t& key : m_keys) {
+      key = generator();
+    }
+  }
+
+  uint64_t key(uint32_t node) const
+  {
+    return m_keys[node];
+  }
+
+  size_t size() const
+  {
+    return m_offsets.size() - 1;
+  }
+
+  /**
+   * @brief Add the sorted set with the given hash and return its id.
+   */
+  size_t insert(
+      const std::vector<uint32_t>& subset,
+      uint64_t hash)
+  {
+    size_t id = size();
+    m_nodes.insert(m_nodes.end(), subset.begin(), subset.end());
+    m_offsets.push_back(m_nodes.size());
+    size_t next = NONE;
+    auto inserted = m_heads.emplace(hash, id);
+    if (!inserted.second) {
+      next = inserted.first->second;
+      inserted.first->second = id;
+    }
+    m_chain.push_back(next);
+    return id;
+  }
+
+  /**
+   * @brief Return the id of the sorted set with the given hash or \ref NONE if it has not been added.
+   */
+  size_t find(
+      const std::vector<uint32_t>& subset,
+      uint64_t hash) const
+  {
+    auto foundIter = m_heads.find(hash);
+    if (foundIter == m_heads.end()) {
+      return NONE;
+    }
+    for (size_t id = foundIter->second; id != NONE; id = m_chain[id]) {
+      if (m_offsets[id + 1] - m_offsets[id] == subset.size()
+          && std::equal(subset.begin(), subset.end(), m_nodes.begin() + m_offsets[id])) {
+        return id;
+      }
+    }
+    return NONE;
+  }
+
+private:
+
+  std::vector<uint64_t> m_keys;
+  std::vector<size_t> m_offsets;
+  std::vector<uint32_t> m_nodes;
+  std::unordered_map<uint64_t, size_t> m_heads;
+  std::vector<size_t> m_chain;
+};
+
+/**
+ * @brief Visitor of the enumeration on an index graph reporting the containment lattice of the subgraphs.
+ *
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the subgraphs and the edges of the lattice.
+ *
+ * Every emitted subgraph gets the next id. The subgraph it was extended from in the recursion is a
+ * parent known from the stack of ids. All other parents and children that have already been emitted
+ * are looked up in a \ref SubsetIndex by removing each node and by adding each neighbor, so every
+ * edge is reported exactly once when its later subgraph is emitted.
+ */
+template<typename Node,
+         typename Compare,
+         typename Visitor>
+class LatticeBuilder : public EnumerationVisitor
+{
+public:
+
+  LatticeBuilder(
+      const CsrGraph<uint32_t>& graph,
+      const std::vector<Node>& nodes,
+      Visitor& visitor,
+      const Compare& compare)
+    : m_graph(graph),
+      m_nodes(nodes),
+      m_visitor(visitor),
+      m_compare(compare),
+      m_index(graph.nofNodes()),
+      m_stamps(graph.nofNodes(), 0) {}
+
+  void push(uint32_t node)
+  {
+    m_pushed.push_back(node);
+    m_hash ^= m_index.key(node);
+  }
+
+  void pop(uint32_t node)
+  {
+    m_pushed.pop_back();
+    m_ids.pop_back();
+    m_hash ^= m_index.key(node);
+  }
+
+  void emit(const std::vector<uint32_t>& subgraph)
+  {
+    size_t id = m_index.size();
+    mapSubgraph(subgraph, m_nodes, m_mapped, m_compare);
+    m_visitor.node(id, m_mapped);
+    if (!m_ids.empty()) {
+      m_visitor.edge(m_ids.back(), id);
+    }
+
+    uint32_t treeNode = m_pushed.back();
+    for (size_t pos = 0; subgraph.size() > 1 && pos < subgraph.size(); ++pos) {
+      if (subgraph[pos] == treeNode) {
+        continue;
+      }
+      m_neighbor.assign(subgraph.begin(), subgraph.begin() + pos);
+      m_neighbor.insert(m_neighbor.end(), subgraph.begin() + pos + 1, subgraph.end());
+      size_t parent = m_index.find(m_neighbor, m_hash ^ m_index.key(subgraph[pos]));
+      if (parent != SubsetIndex::NONE) {
+        m_visitor.edge(parent, id);
+      }
+    }
+
+    ++m_stamp;
+    for (uint32_t node : subgraph) {
+      m_stamps[node] = m_stamp;
+    }
+    for (uint32_t node : subgraph) {
+      for (const uint32_t* iter = m_graph.neighborsBegin(node); iter != m_graph.neighborsEnd(node); ++iter) {
+        if (m_stamps[*iter] == m_stamp) {
+          continue;
+        }
+        m_stamps[*iter] = m_stamp;
+        m_neighbor = subgraph;
+        m_neighbor.insert(std::lower_bound(m_neighbor.begin(), m_neighbor.end(), *iter), *iter);
+        size_t child = m_index.find(m_neighbor, m_hash ^ m_index.key(*iter));
+        if (child != SubsetIndex::NONE) {
+          m_visitor.edge(id, child);
+        }
+      }
+    }
+
+    m_index.insert(subgraph, m_hash);
+    m_ids.push_back(id);
+  }
+
+private:
+
+  const CsrGraph<uint32_t>& m_graph;
+  const std::vector<Node>& m_nodes;
+  Visitor& m_visitor;
+  const Compare& m_compare;
+  SubsetIndex m_index;
+  std::vector<size_t> m_stamps;
+  size_t m_stamp = 0;
+  uint64_t m_hash = 0;
+  std::vector<uint32_t> m_pushed;
+  std::vector<size_t> m_ids;
+  std::vector<uint32_t> m_neighbor;
+  std::vector<Node> m_mapped;
+};
+
+/**
+ * @brief Perform the enumeration and report the containment lattice of the subgraphs to a visitor.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the subgraphs and the edges of the lattice.
+ *
+ * @param graph The input graph
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param visitor Receives the subgraphs with their ids and the edges of the lattice.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ *
+ * See \ref LatticeBuilder for details.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare,
+         typename Visitor>
+void visitLatticeEnumeration(
+    const Graph& graph,
+    size_t upper,
+    Visitor& visitor,
+    const Compare& compare)
+{
+  IndexGraph<Node> indexGraph = buildIndexGraph<Graph, Node>(graph, compare);
+  LatticeBuilder<Node, Compare, Visitor> builder(indexGraph.graph, indexGraph.nodes, visitor, compare);
+  visitEnumeration<CsrGraph<uint32_t>, uint32_t>(indexGraph.graph, upper, NoFilter(), builder, std::less<uint32_t>());
+}
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -0,0 +1,311 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "../CsrGraph.hpp"
+#include "../GraphTraits.hpp"
+#include "IndexGraph.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Sequence of records of a fixed number of node indices, kept in memory up to a bound
+ *        and spilled to a temporary file beyond it.
+ *
+ * If no temporary file can be created, all records are kept in memory. If the file cannot be
+ * written or read back completely, the frontier is marked as failed and drops further records.
+ */
+class SpillingFrontier
+{
+public:
+
+  /**
+   * @param recordSize Number of node indices per record.
+   * @param maxBytes Memory bound of the records before they are spilled.
+   * @param file Optional file opened for update used instead of a temporary file, closed by the frontier.
+   */
+  SpillingFrontier(
+      size_t recordSize,
+      size_t maxBytes,
+      std::FILE* file = nullptr)
+    : m_recordSize(recordSize),
+      m_maxEntries(std::max(maxBytes / sizeof(uint32_t), recordSize)),
+      m_file(file) {}
+
+  SpillingFrontier(const SpillingFrontier&) = delete;
+  SpillingFrontier& operator=(const SpillingFrontier&) = delete;
+
+  ~SpillingFrontier()
+  {
+    if (m_file != nullptr) {
+      std::fclose(m_file);
+    }
+  }
+
+  size_t recordSize() const
+  {
+    return m_recordSize;
+  }
+
+  size_t nofRecords() const
+  {
+    return (m_nofSpilled + m_buffer.size()) / m_recordSize;
+  }
+
+  bool spilled() const
+  {
+    return m_nofSpilled != 0;
+  }
+
+  /**
+   * @brief True if records were lost because the spill file could not be written or read back.
+   */
+  bool failed() const
+  {
+    return m_failed;
+  }
+
+  void append(const uint32_t* record)
+  {
+    if (m_failed) {
+      return;
+    }
+    m_buffer.insert(m_buffer.end(), record, record + m_recordSize);
+    if (m_buffer.size() + m_recordSize > m_maxEntries) {
+      spill();
+    }
+  }
+
+  /**
+   * @brief Call 'func' with a pointer to every record in the order of appending.
+   *
+   * Spilled records are read back in blocks of at most the memory bound. Stops and returns false
+   * if the frontier has failed, i.e. if not every record could be passed to 'func'.
+   */
+  template<typename Func>
+  bool forEach(const Func& func)
+  {
+    if (m_failed) {
+      return false;
+    }
+    if (m_nofSpilled != 0) {
+      // buffered writes may fail only when they are flushed
+      if (std::fflush(m_file) != 0 || std::fseek(m_file, 0, SEEK_SET) != 0) {
+        m_failed = true;
+        return false;
+      }
+      size_t blockEntries = m_maxEntries / m_recordSize * m_recordSize;
+      std::vector<uint32_t> block(blockEntries);
+      size_t remaining = m_nofSpilled;
+      while (remaining != 0) {
+        size_t nofEntries = std::fread(block.data(), sizeof(uint32_t), std::min(remaining, blockEntries), m_file);
+        if (nofEntries % m_recordSize != 0 || (nofEntries == 0 && remaining != 0)) {
+          m_failed = true;
+        }
+        remaining -= nofEntries;
+        for (size_t pos = 0; pos + m_recordSize <= nofEntries; pos += m_recordSize) {
+          func(block.data() + pos);
+        }
+        if (m_failed) {
+          return false;
+        }
+      }
+    }
+    for (size_t pos = 0; pos < m_buffer.size(); pos += m_recordSize) {
+      func(m_buffer.data() + pos);
+    }
+    return true;
+  }
+
+private:
+
+  void spill()
+  {
+    if (m_file == nullptr) {
+      m_file = std::tmpfile();
+      if (m_file == nullptr) {
+        m_maxEntries = std::numeric_limits<size_t>::max();
+        return;
+      }
+    }
+    size_t nofWritten = std::fwrite(m_buffer.data(), sizeof(uint32_t), m_buffer.size(), m_file);
+    m_nofSpilled += nofWritten;
+    if (nofWritten != m_buffer.size()) {
+      m_failed = true;
+    }
+    m_buffer.clear();
+  }
+
+  size_t m_recordSize;
+  size_t m_maxEntries;
+  std::vector<uint32_t> m_buffer;
+  std::FILE* m_file;
+  size_t m_nofSpilled = 0;
+  bool m_failed = false;
+};
+
+/**
+ * @brief Enumeration of connected induced subgraphs of an index graph ordered by their size.
+ *
+ * Performs the recursion of CONSENS breadth-first: the frontier of a level holds every subgraph
+ * of that size as its path, i.e. its smallest node followed by the nodes in the order in which
+ * the recursion adds them. The candidates of a subgraph are recomputed from its path, since a
+ * neighbor w larger than the smallest node is forbidden exactly if it is smaller than a node that
+ * was added after the first node of the path adjacent to w. A frontier therefore takes only the
+ * size of its subgraphs per subgraph and is spilled to a temporary file beyond the memory bound.
+ */
+class LevelWiseSearch
+{
+public:
+
+  LevelWiseSearch(
+      const CsrGraph<uint32_t>& graph,
+      size_t maxFrontierBytes)
+    : m_graph(graph),
+      m_maxFrontierBytes(maxFrontierBytes),
+      m_stamps(graph.nofNodes(), 0) {}
+
+  /**
+   * @brief Enumerate all subgraphs with at most 'upper' nodes level by level.
+   *
+   * @param upper Upper bound for the size of the subgraphs.
+   * @param emit Called with every subgraph, sorted ascending.
+   * @param finishLevel Called with the size of the subgraphs after all subgraphs of that size.
+   *
+   * @return false if a frontier could not be spilled or read back, in which case the enumeration
+   *         stops after the subgraphs emitted so far and the level is not reported as finished.
+   */
+  template<typename Emit,
+           typename FinishLevel>
+  bool run(
+      size_t upper,
+      const Emit& emit,
+      const FinishLevel& finishLevel)
+  {
+    if (upper == 0 || m_graph.nofNodes() == 0) {
+      return true;
+    }
+    std::unique_ptr<SpillingFrontier> frontier(new SpillingFrontier(1, m_maxFrontierBytes));
+    for (uint32_t root = 0; root < m_graph.nofNodes(); ++root) {
+      frontier->append(&root);
+    }
+    std::vector<uint32_t> subgraph;
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> record;
+    for (size_t size = 1; frontier->nofRecords() != 0; ++size) {
+      std::unique_ptr<SpillingFrontier> next(new SpillingFrontier(size + 1, m_maxFrontierBytes));
+      bool complete = frontier->forEach([&](const uint32_t* path) {
+        subgraph.assign(path, path + size);
+        std::sort(subgraph.begin(), subgraph.end());
+        emit(subgraph);
+        if (size < upper) {
+          getCandidates(path, size, candidates);
+          record.assign(path, path + size + 1);
+          for (uint32_t candidate : candidates) {
+            record.back() = candidate;
+            next->append(record.data());
+          }
+        }
+      });
+      if (!complete || next->failed()) {
+        return false;
+      }
+      finishLevel(size);
+      frontier = std::move(next);
+    }
+    return true;
+  }
+
+private:
+
+  void getCandidates(
+      const uint32_t* path,
+      size_t size,
+      std::vector<uint32_t>& candidates)
+  {
+    candidates.clear();
+    m_laterMaximum.assign(size, 0);
+    for (size_t pos = size - 1; pos > 0; --pos) {
+      m_laterMaximum[pos - 1] = std::max(m_laterMaximum[pos], path[pos]);
+    }
+    ++m_stamp;
+    for (size_t pos = 0; pos < size; ++pos) {
+      m_stamps[path[pos]] = m_stamp;
+    }
+    uint32_t root = path[0];
+    for (size_t pos = 0; pos < size; ++pos) {
+      for (const uint32_t* iter = m_graph.neighborsBegin(path[pos]); iter != m_graph.neighborsEnd(path[pos]); ++iter) {
+        if (*iter > root && m_stamps[*iter] != m_stamp) {
+          m_stamps[*iter] = m_stamp;
+          if (*iter > m_laterMaximum[pos]) {
+            candidates.push_back(*iter);
+          }
+        }
+      }
+    }
+    std::sort(candidates.begin(), candidates.end());
+  }
+
+  const CsrGraph<uint32_t>& m_graph;
+  size_t m_maxFrontierBytes;
+  std::vector<size_t> m_stamps;
+  size_t m_stamp = 0;
+  std::vector<uint32_t> m_laterMaximum;
+};
+
+/**
+ * @brief Perform the enumeration ordered by the size of the subgraphs and report it to a visitor.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the subgraphs and the finished levels.
+ *
+ * @param graph The input graph
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the subgraphs.
+ *        Must accept std::vector<Node> as input and return a boolean.
+ * @param visitor Receives the subgraphs fulfilling the filter and the end of every level.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ * @param maxFrontierBytes Memory bound of a frontier before it is spilled to a temporary file.
+ *
+ * @return false if the temporary file failed and the enumeration is incomplete.
+ *
+ * See \ref LevelWiseSearch for details.
+ */
+template<typename Graph,
+         typename Node,
+         typename FilterFunc,
+         typename Compare,
+         typename Visitor>
+bool visitLevelWiseEnumeration(
+    const Graph& graph,
+    size_t upper,
+    const FilterFunc& filter,
+    Visitor& visitor,
+    const Compare& compare,
+    size_t maxFrontierBytes)
+{
+  IndexGraph<Node> indexGraph = buildIndexGraph<Graph, Node>(graph, compare);
+  LevelWiseSearch search(indexGraph.graph, maxFrontierBytes);
+  std::vector<Node> mapped;
+  return search.run(upper, [&](const std::vector<uint32_t>& subgraph) {
+    mapSubgraph(subgraph, indexGraph.nodes, mapped, compare);
+    if (filter(mapped)) {
+      visitor.emit(mapped);
+    }
+  }, [&](size_t size) {
+    visitor.levelFinished(size);
+  });
+}
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -0,0 +1,318 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <set>
+#include <vector>
+
+#include "../CsrGraph.hpp"
+#include "../GraphTraits.hpp"
+#include "IndexedEnumeration.hpp"
+#include "IndexGraph.hpp"
+#include "TraitHooks.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Visited nodes of the breadth-first search of \ref LocalSearch and the positions of the
+ *        nodes of the ball, found by binary search in the sorted ball.
+ *
+ * The visited nodes are kept in a set that is cleared for every root.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare,
+         bool hasIndex = HasIndexHook<Graph>::value>
+class BallPositions
+{
+public:
+
+  BallPositions(
+      const Graph& graph,
+      const Compare& compare)
+    : m_visited(compare),
+      m_compare(compare) {}
+
+  void clear()
+  {
+    m_visited.clear();
+  }
+
+  /**
+   * @brief Mark 'node' as visited and return whether it has not been visited since the last clear.
+   */
+  bool visit(const Node& node)
+  {
+    return m_visited.insert(node).second;
+  }
+
+  /**
+   * @brief Assign the positions of the nodes of the ball sorted by 'compare'. The ball is referenced.
+   */
+  void assign(const std::vector<Node>& ball)
+  {
+    m_ball = &ball;
+  }
+
+  /**
+   * @brief Position of 'node' in the ball or the size of the ball if it is not contained.
+   */
+  uint32_t operator()(const Node& node) const
+  {
+    auto iter = std::lower_bound(m_ball->begin(), m_ball->end(), node, m_compare);
+    if (iter == m_ball->end() || m_compare(node, *iter)) {
+      return static_cast<uint32_t>(m_ball->size());
+    }
+    return static_cast<uint32_t>(iter - m_ball->begin());
+  }
+
+private:
+
+  std::set<Node, Compare> m_visited;
+  Compare m_compare;
+  const std::vector<Node>* m_ball = nullptr;
+};
+
+/**
+ * @brief Visited nodes of the breadth-first search of \ref LocalSearch and the positions of the
+ *        nodes of the ball, kept in arrays indexed by the 'index' hook of the traits.
+ *
+ * A node is visited or has a position if its stamp equals the stamp of the current root, so the
+ * arrays are allocated once and never cleared.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+class BallPositions<Graph, Node, Compare, true>
+{
+public:
+
+  BallPositions(
+      const Graph& graph,
+      const Compare& compare)
+    : m_graph(graph),
+      m_stamps(GraphTraits<Graph>::nodeCount(graph), 0),
+      m_positions(GraphTraits<Graph>::nodeCount(graph), 0) {}
+
+  void clear()
+  {
+    ++m_stamp;
+    m_nofBall = 0;
+  }
+
+  bool visit(const Node& node)
+  {
+    size_t idx = GraphTraits<Graph>::index(node, m_graph);
+    if (m_stamps[idx] == m_stamp) {
+      return false;
+    }
+    m_stamps[idx] = m_stamp;
+    m_positions[idx] = std::numeric_limits<uint32_t>::max();
+    return true;
+  }
+
+  void assign(const std::vector<Node>& ball)
+  {
+    m_nofBall = static_cast<uint32_t>(ball.size());
+    for (size_t pos = 0; pos < ball.size(); ++pos) {
+      m_positions[GraphTraits<Graph>::index(ball[pos], m_graph)] = static_cast<uint32_t>(pos);
+    }
+  }
+
+  uint32_t operator()(const Node& node) const
+  {
+    size_t idx = GraphTraits<Graph>::index(node, m_graph);
+    if (m_stamps[idx] != m_stamp || m_positions[idx] == std::numeric_limits<uint32_t>::max()) {
+      return m_nofBall;
+    }
+    return m_positions[idx];
+  }
+
+private:
+
+  const Graph& m_graph;
+  std::vector<size_t> m_stamps;
+  std::vector<uint32_t> m_positions;
+  size_t m_stamp = 0;
+  uint32_t m_nofBall = 0;
+};
+
+/**
+ * @brief Enumeration of the connected induced subgraphs whose nodes are all within a given
+ *        number of hops of their smallest node.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * For every root the nodes not smaller than the root with a distance of at most 'radius' to the
+ * root in the whole graph are collected by a breadth-first search, which never goes deeper than the
+ * upper bound minus one. The subgraph induced by this ball is copied to an index graph with the
+ * positions of its nodes in the order of 'compare', so the root has index 0, and the recursion of
+ * \ref IndexedGenerator runs on this copy. Candidates outside of the ball are therefore never
+ * considered and the forbidden nodes of the root are empty instead of all smaller nodes.
+ * The work per root only depends on its ball, except for the arrays of the 'index' hook allocated once
+ * for all roots. Every root emits exactly the subgraphs with this root as smallest node in the order of
+ * \ref visitEnumeration, so the roots are independent units.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+class LocalSearch
+{
+public:
+
+  LocalSearch(
+      const Graph& graph,
+      size_t radius,
+      const Compare& compare)
+    : m_graph(graph),
+      m_radius(radius),
+      m_compare(compare),
+      m_positions(graph, m_compare) {}
+
+  /**
+   * @brief Enumerate all subgraphs with smallest node 'root' and at most 'upper' nodes
+   *        within the radius of the root.
+   */
+  template<typename FilterFunc,
+           typename Visitor>
+  void run(
+      const Node& root,
+      size_t upper,
+      const FilterFunc& filter,
+      Visitor& visitor)
+  {
+    if (upper == 0) {
+      return;
+    }
+    collectBall(root, std::min(m_radius, upper - 1));
+    CsrGraph<uint32_t> ballGraph = buildBallGraph();
+    std::vector<uint32_t> indices(m_ball.size());
+    for (size_t pos = 0; pos < indices.size(); ++pos) {
+      indices[pos] = static_cast<uint32_t>(pos);
+    }
+    std::less<uint32_t> indexCompare;
+    IndexedGenerator<CsrGraph<uint32_t>, uint32_t, std::less<uint32_t>> generator(ballGraph, indices, indexCompare);
+    MappedFilter<Node, FilterFunc, Compare> mappedFilter(m_ball, filter, m_compare);
+    MappingVisitor<Node, Compare, Visitor> mappingVisitor(m_ball, visitor, m_compare);
+    generator.run(0, upper, mappedFilter, mappingVisitor);
+  }
+
+  /**
+   * @brief Nodes of the ball of the last root, sorted by 'compare' and starting with the root.
+   */
+  const std::vector<Node>& ball() const
+  {
+    return m_ball;
+  }
+
+private:
+
+  void collectBall(
+      const Node& root,
+      size_t radius)
+  {
+    m_ball.assign(1, root);
+    m_positions.clear();
+    m_positions.visit(root);
+    m_layer.assign(1, root);
+    for (size_t distance = 0; distance < radius && !m_layer.empty(); ++distance) {
+      m_nextLayer.clear();
+      for (const Node& node : m_layer) {
+        auto begin = GraphTraits<Graph>::adjancencyBegin(node, m_graph);
+        auto end = GraphTraits<Graph>::adjancencyEnd(node, m_graph);
+        for (auto iter = begin; iter != end; ++iter) {
+          if (m_positions.visit(*iter)) {
+            m_nextLayer.push_back(*iter);
+            if (m_compare(root, *iter)) {
+              m_ball.push_back(*iter);
+            }
+          }
+        }
+      }
+      std::swap(m_layer, m_nextLayer);
+    }
+    std::sort(m_ball.begin(), m_ball.end(), m_compare);
+    m_positions.assign(m_ball);
+  }
+
+  /**
+   * @brief Copy the subgraph induced by the ball with the positions of its nodes as indices.
+   */
+  CsrGraph<uint32_t> buildBallGraph() const
+  {
+    std::vector<size_t> offsets(m_ball.size() + 1, 0);
+    std::vector<uint32_t> neighbors;
+    for (size_t pos = 0; pos < m_ball.size(); ++pos) {
+      auto begin = GraphTraits<Graph>::adjancencyBegin(m_ball[pos], m_graph);
+      auto end = GraphTraits<Graph>::adjancencyEnd(m_ball[pos], m_graph);
+      for (auto iter = begin; iter != end; ++iter) {
+        uint32_t neighbor = m_positions(*iter);
+        if (neighbor != m_ball.size()) {
+          neighbors.push_back(neighbor);
+        }
+      }
+      offsets[pos + 1] = neighbors.size();
+      if (!std::is_sorted(neighbors.begin() + offsets[pos], neighbors.end())) {
+        std::sort(neighbors.begin() + offsets[pos], neighbors.end());
+      }
+    }
+    return CsrGraph<uint32_t>(std::move(offsets), std::move(neighbors));
+  }
+
+  const Graph& m_graph;
+  size_t m_radius;
+  Compare m_compare;
+  BallPositions<Graph, Node, Compare> m_positions;
+  std::vector<Node> m_ball;
+  std::vector<Node> m_layer;
+  std::vector<Node> m_nextLayer;
+};
+
+/**
+ * @brief Perform the radius-bounded enumeration for all roots and report it to a visitor.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the enumeration events.
+ *
+ * @param graph The input graph
+ * @param radius Maximum distance of every node of a subgraph to its smallest node.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the subgraphs.
+ *        Must accept std::vector<Node> as input and return a boolean.
+ * @param visitor Receives the push, pop and emit events of the enumeration.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ *
+ * See \ref LocalSearch for details.
+ */
+template<typename Graph,
+         typename Node,
+         typename FilterFunc,
+         typename Compare,
+         typename Visitor>
+void visitLocalEnumeration(
+    const Graph& graph,
+    size_t radius,
+    size_t upper,
+    const FilterFunc& filter,
+    Visitor& visitor,
+    const Compare& compare)
+{
+  std::vector<Node> nodesVector(GraphTraits<Graph>::nodesBegin(graph), GraphTraits<Graph>::nodesEnd(graph));
+  std::sort(nodesVector.begin(), nodesVector.end(), compare);
+  LocalSearch<Graph, Node, Compare> search(graph, radius, compare);
+  for (const Node& root : nodesVector) {
+    search.run(root, upper, filter, visitor);
+  }
+}
+
+} // end namespace Intern
+} // end namespace ConsensLib
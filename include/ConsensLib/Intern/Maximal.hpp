@@ -0,0 +1,187 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "../GraphTraits.hpp"
+#include "Enumeration.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Check whether one of the forbidden neighbors of a subgraph extends it to a subgraph
+ *        that still fulfills the predicate.
+ *
+ * @param graph The input graph
+ * @param predicate Hereditary predicate.
+ * @param current Currently considered subgraph.
+ * @param forbidden Forbidden nodes of the currently considered subgraph.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ */
+template<typename Graph,
+         typename Node,
+         typename Predicate,
+         typename Compare>
+bool extendsByForbidden(
+    const Graph& graph,
+    const Predicate& predicate,
+    std::vector<Node>& current,
+    const std::vector<Node>& forbidden,
+    const Compare& compare)
+{
+  std::vector<Node> extensions;
+  for (const Node& node : current) {
+    auto begin = GraphTraits<Graph>::adjancencyBegin(node, graph);
+    auto end = GraphTraits<Graph>::adjancencyEnd(node, graph);
+    for (auto neighborIter = begin; neighborIter != end; ++neighborIter) {
+      auto foundIter = std::lower_bound(forbidden.begin(), forbidden.end(), *neighborIter, compare);
+      if (foundIter != forbidden.end() && !compare(*neighborIter, *foundIter)) {
+        extensions.push_back(*neighborIter);
+      }
+    }
+  }
+  std::sort(extensions.begin(), extensions.end(), compare);
+  auto uniqueEnd = std::unique(extensions.begin(), extensions.end(), [&compare](const Node& n1, const Node& n2) {
+    return !compare(n1, n2) && !compare(n2, n1);
+  });
+  for (auto extensionIter = extensions.begin(); extensionIter != uniqueEnd; ++extensionIter) {
+    auto subgraphIter = std::lower_bound(current.begin(), current.end(), *extensionIter, compare);
+    subgraphIter = current.insert(subgraphIter, *extensionIter);
+    bool fulfilled = predicate(current);
+    current.erase(subgraphIter);
+    if (fulfilled) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Perform a recursive call for a subgraph fulfilling a hereditary predicate
+ *        and emit it if it is maximal.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Predicate Type of the hereditary predicate.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the enumeration events.
+ *
+ * @param graph The input graph
+ * @param upper Upper bound for the size of the subgraphs.
+ * @param predicate Hereditary predicate, fulfilled by the currently considered subgraph.
+ * @param current Currently considered subgraph.
+ * @param candidates Neighboring nodes that can be added to the subgraph.
+ * @param forbidden Forbidden nodes that can never be added to this subgraph.
+ * @param visitor Receives the push, pop and emit events of the enumeration.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ *
+ * Every neighbor of the subgraph is either a candidate or forbidden. The predicate is evaluated
+ * once for each candidate extension and only the extensions fulfilling it are recursed into,
+ * since no super graph of a subgraph violating a hereditary predicate can fulfill it. If no
+ * candidate extension fulfills the predicate, the forbidden neighbors are tried as well.
+ * The subgraph is maximal if neither does, or if it already reached the upper bound.
+ */
+template<typename Graph,
+         typename Node,
+         typename Predicate,
+         typename Compare,
+         typename Visitor>
+void generateMaximalRecursive(
+    const Graph& graph,
+    size_t upper,
+    const Predicate& predicate,
+    std::vector<Node>& current,
+    const std::vector<Node>& candidates,
+    const std::vector<Node>& forbidden,
+    Visitor& visitor,
+    const Compare& compare)
+{
+  std::vector<bool> fulfilled(candidates.size(), false);
+  bool maximal = true;
+  if (current.size() < upper) {
+    for (size_t pos = 0; pos < candidates.size(); ++pos) {
+      auto subgraphIter = std::lower_bound(current.begin(), current.end(), candidates[pos], compare);
+      subgraphIter = current.insert(subgraphIter, candidates[pos]);
+      fulfilled[pos] = predicate(current);
+      current.erase(subgraphIter);
+      maximal = maximal && !fulfilled[pos];
+    }
+    if (maximal) {
+      maximal = !extendsByForbidden(graph, predicate, current, forbidden, compare);
+    }
+  }
+  if (maximal) {
+    visitor.emit(current);
+  }
+  for (auto candidateIter = candidates.begin(); candidateIter != candidates.end(); ++candidateIter) {
+    if (!fulfilled[candidateIter - candidates.begin()]) {
+      continue;
+    }
+    auto subgraphIter = std::lower_bound(current.begin(), current.end(), *candidateIter, compare);
+    current.insert(subgraphIter, *candidateIter);
+    visitor.push(*candidateIter);
+    std::vector<Node> nextCandidates;
+    std::vector<Node> nextForbidden;
+    updateSets(graph, current, candidates, candidateIter, forbidden, nextCandidates, nextForbidden, compare);
+    generateMaximalRecursive(graph, upper, predicate, current, nextCandidates, nextForbidden, visitor, compare);
+    auto eraseIter = std::lower_bound(current.begin(), current.end(), *candidateIter, compare);
+    current.erase(eraseIter);
+    visitor.pop(*candidateIter);
+  }
+}
+
+/**
+ * @brief Perform the enumeration of the maximal subgraphs fulfilling a hereditary predicate
+ *        and report it to a visitor.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Predicate Type of the hereditary predicate.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the enumeration events.
+ *
+ * @param graph The input graph
+ * @param upper Upper bound for the size of the subgraphs.
+ * @param predicate Hereditary predicate. Must accept std::vector<Node> as input and return a boolean.
+ * @param visitor Receives the push, pop and emit events of the enumeration.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ *
+ * Roots violating the predicate are skipped. See \ref generateMaximalRecursive for details.
+ */
+template<typename Graph,
+         typename Node,
+         typename Predicate,
+         typename Compare,
+         typename Visitor>
+void visitMaximalEnumeration(
+    const Graph& graph,
+    size_t upper,
+    const Predicate& predicate,
+    Visitor& visitor,
+    const Compare& compare)
+{
+  if (upper == 0) {
+    return;
+  }
+  auto nodesBegin = GraphTraits<Graph>::nodesBegin(graph);
+  auto nodesEnd = GraphTraits<Graph>::nodesEnd(graph);
+  std::vector<Node> nodesVector(nodesBegin, nodesEnd);
+  std::sort(nodesVector.begin(), nodesVector.end(), compare);
+  for (auto iter = nodesVector.cbegin(); iter != nodesVector.cend(); ++iter) {
+    std::vector<Node> current({*iter});
+    if (!predicate(current)) {
+      continue;
+    }
+    std::vector<Node> candidates;
+    std::vector<Node> forbidden;
+    getRootSets(graph, nodesVector, iter, candidates, forbidden, compare);
+    visitor.push(*iter);
+    generateMaximalRecursive(graph, upper, predicate, current, candidates, forbidden, visitor, compare);
+    visitor.pop(*iter);
+  }
+}
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../CsrGraph.hpp"
+#include "../Types.hpp"
+#include "Enumeration.hpp"
+#include "IndexGraph.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Compute the order of the nodes of an index graph for a given strategy.
+ *
+ * @param graph The index graph.
+ * @param order The ordering strategy.
+ * @param seed Seed for the random order.
+ *
+ * @return The nodes of the graph in the computed order. Ties are broken by the index.
+ */
+inline std::vector<uint32_t> computeNodeOrder(
+    const CsrGraph<uint32_t>& graph,
+    NodeOrder order,
+    unsigned seed)
+{
+  uint32_t nofNodes = static_cast<uint32_t>(graph.nofNodes());
+  std::vector<uint32_t> result(nofNodes);
+  std::iota(result.begin(), result.end(), 0u);
+  switch (order) {
+  case NodeOrder::DEGREE_DESCENDING:
+    std::stable_sort(result.begin(), result.end(), [&graph](uint32_t n1, uint32_t n2) {
+      return graph.degree(n1) > graph.degree(n2);
+    });
+    break;
+  case NodeOrder::DEGENERACY: {
+    std::vector<size_t> degrees(nofNodes);
+    std::set<std::pair<size_t, uint32_t>> queue;
+    for (uint32_t node = 0; node < nofNodes; ++node) {
+      degrees[node] = graph.degree(node);
+      queue.emplace(degrees[node], node);
+    }
+    std::vector<bool> removed(nofNodes, false);
+    result.clear();
+    while (!queue.empty()) {
+      uint32_t node = queue.begin()->second;
+      queue.erase(queue.begin());
+      removed[node] = true;
+      result.push_back(node);
+      for (const uint32_t* iter = graph.neighborsBegin(node); iter != graph.neighborsEnd(node); ++iter) {
+        if (!removed[*iter]) {
+          queue.erase(std::make_pair(degrees[*iter], *iter));
+          queue.emplace(--degrees[*iter], *iter);
+        }
+      }
+    }
+    break;
+  }
+  case NodeOrder::CUTHILL_MCKEE: {
+    std::vector<uint32_t> byDegree(result);
+    std::stable_sort(byDegree.begin(), byDegree.end(), [&graph](uint32_t n1, uint32_t n2) {
+      return graph.degree(n1) < graph.degree(n2);
+    });
+    std::vector<bool> visited(nofNodes, false);
+    result.clear();
+    std::vector<uint32_t> neighbors;
+    for (uint32_t start : byDegree) {
+      if (visited[start]) {
+        continue;
+      }
+      visited[start] = true;
+      size_t head = result.size();
+      result.push_back(start);
+      while (head < result.size()) {
+        uint32_t node = result[head++];
+        neighbors.clear();
+        for (const uint32_t* iter = graph.neighborsBegin(node); iter != graph.neighborsEnd(node); ++iter) {
+          if (!visited[*iter]) {
+            visited[*iter] = true;
+            neighbors.push_back(*iter);
+          }
+        }
+        std::stable_sort(neighbors.begin(), neighbors.end(), [&graph](uint32_t n1, uint32_t n2) {
+          return graph.degree(n1) < graph.degree(n2);
+        });
+        result.insert(result.end(), neighbors.begin(), neighbors.end());
+      }
+    }
+    break;
+  }
+  case NodeOrder::RANDOM: {
+    std::mt19937 generator(seed);
+    std::shuffle(result.begin(), result.end(), generator);
+    break;
+  }
+  default:
+    break;
+  }
+  return result;
+}
+
+/**
+ * @brief Relabel an index graph such that the indices follow a given order of its nodes.
+ *
+ * @param indexGraph The index graph which is relabeled in place.
+ * @param order The nodes of the graph in the target order.
+ */
+template<typename Node>
+void applyNodeOrder(
+    IndexGraph<Node>& indexGraph,
+    const std::vector<uint32_t>& order)
+{
+  std::vector<uint32_t> newIndex(order.size());
+  std::vector<Node> nodes;
+  nodes.reserve(order.size());
+  for (uint32_t pos = 0; pos < order.size(); ++pos) {
+    newIndex[order[pos]] = pos;
+    nodes.push_back(indexGraph.nodes[order[pos]]);
+  }
+  indexGraph.graph = indexGraph.graph.permuted(newIndex);
+  indexGraph.nodes = std::move(nodes);
+}
+
+/**
+ * @brief Perform the enumeration on a copy of the graph relabeled by an ordering strategy
+ *        and report it to a visitor in terms of the original nodes.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the enumeration events.
+ *
+ * @param graph The input graph
+ * @param order The ordering strategy replacing the order of 'compare' during the enumeration.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the subgraphs.
+ *        Must accept std::vector<Node> as input and return a boolean.
+ * @param visitor Receives the push, pop and emit events of the enumeration.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ *        It is used for the relabeling, to break ties of the strategy and to sort the emitted node sets.
+ * @param seed Seed for the random order.
+ */
+template<typename Graph,
+         typename Node,
+         typename FilterFunc,
+         typename Compare,
+         typename Visitor>
+void visitOrderedEnumeration(
+    const Graph& graph,
+    NodeOrder order,
+    size_t upper,
+    const FilterFunc& filter,
+    Visitor& visitor,
+    const Compare& compare,
+    unsigned seed)
+{
+  IndexGraph<Node> indexGraph = buildIndexGraph<Graph, Node>(graph, compare);
+  if (order != NodeOrder::COMPARE) {
+    applyNodeOrder(indexGraph, computeNodeOrder(indexGraph.graph, order, seed));
+  }
+  MappingVisitor<Node, Compare, Visitor> mappingVisitor(indexGraph.nodes, visitor, compare);
+  MappedFilter<Node, FilterFunc, Compare> mappedFilter(indexGraph.nodes, filter, compare);
+  visitEnumeration<CsrGraph<uint32_t>, uint32_t>(indexGraph.graph, upper, mappedFilter, mappingVisitor,
+                                                 std::less<uint32_t>());
+}
+
+} // end namespace Intern
+} // end namespace ConsensLib
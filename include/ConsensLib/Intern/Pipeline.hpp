@@ -0,0 +1,319 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../Types.hpp"
+#include "BoundedQueue.hpp"
+#include "Enumeration.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Consecutive subgraphs of the enumeration stored in one flat node array.
+ */
+template<typename Node>
+struct SubgraphBatch
+{
+  size_t sequence = 0;
+  std::vector<Node> nodes;
+  std::vector<size_t> ends;
+};
+
+/**
+ * @brief Filtered batches waiting to be delivered in the order of their generation,
+ *        shared between the enumeration and the workers.
+ *
+ * Also records the first exception thrown by the filter on a worker.
+ */
+template<typename Node>
+class PipelineResults
+{
+public:
+
+  void complete(
+      size_t sequence,
+      std::vector<std::vector<Node>>&& subgraphs)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_completed.emplace(sequence, std::move(subgraphs));
+    }
+    m_delivery.notify_one();
+  }
+
+  void fail(std::exception_ptr error)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_error) {
+        m_error = error;
+      }
+      m_failed.store(true);
+    }
+    m_delivery.notify_one();
+  }
+
+  bool failed() const
+  {
+    return m_failed.load();
+  }
+
+  /**
+   * @brief Pass all batches completed in order to 'visitor' and wait until at most 'maxInFlight'
+   *        of the 'nofPushed' batches are neither delivered nor failed.
+   *
+   * The visitor is called without holding the lock, so the workers continue meanwhile.
+   */
+  template<typename Visitor>
+  void deliver(
+      size_t nofPushed,
+      size_t maxInFlight,
+      Visitor& visitor)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!failed()) {
+      auto foundIter = m_completed.find(m_nofDelivered);
+      if (foundIter != m_completed.end()) {
+        std::vector<std::vector<Node>> subgraphs = std::move(foundIter->second);
+        m_completed.erase(foundIter);
+        ++m_nofDelivered;
+        lock.unlock();
+        for (const std::vector<Node>& subgraph : subgraphs) {
+          visitor.emit(subgraph);
+        }
+        lock.lock();
+      }
+      else if (nofPushed - m_nofDelivered > maxInFlight) {
+        m_delivery.wait(lock);
+      }
+      else {
+        break;
+      }
+    }
+  }
+
+  /**
+   * @brief Rethrow the exception of a failed worker, if any.
+   */
+  void rethrow()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_error) {
+      std::rethrow_exception(m_error);
+    }
+  }
+
+private:
+
+  std::mutex m_mutex;
+  std::condition_variable m_delivery;
+  std::map<size_t, std::vector<std::vector<Node>>> m_completed;
+  size_t m_nofDelivered = 0;
+  std::atomic<bool> m_failed{false};
+  std::exception_ptr m_error;
+};
+
+/**
+ * @brief Visitor packing every emitted subgraph into batches and pushing full batches into a queue.
+ *
+ * After every batch the filtered batches are delivered to the visitor of the caller. The enumeration
+ * waits while the queue is full or too many batches are in flight, so it never runs further ahead of
+ * the filter evaluation and the delivery than 'maxInFlight' batches. Once a worker failed, the
+ * enumeration is pruned.
+ */
+template<typename Node,
+         typename Visitor>
+class BatchingVisitor : public EnumerationVisitor
+{
+public:
+
+  BatchingVisitor(
+      BoundedQueue<SubgraphBatch<Node>>& queue,
+      PipelineResults<Node>& results,
+      Visitor& visitor,
+      size_t batchSize,
+      size_t maxInFlight)
+    : m_queue(queue),
+      m_results(results),
+      m_visitor(visitor),
+      m_batchSize(std::max<size_t>(batchSize, 1)),
+      m_maxInFlight(maxInFlight) {}
+
+  void emit(const std::vector<Node>& subgraph)
+  {
+    m_batch.nodes.insert(m_batch.nodes.end(), subgraph.begin(), subgraph.end());
+    m_batch.ends.push_back(m_batch.nodes.size());
+    if (m_batch.ends.size() == m_batchSize) {
+      flush();
+    }
+  }
+
+  bool expand(
+      const std::vector<Node>& current,
+      const std::vector<Node>& candidates)
+  {
+    return !m_results.failed();
+  }
+
+  /**
+   * @brief Push the last batch and deliver all remaining ones.
+   */
+  void finish()
+  {
+    flush();
+    m_results.deliver(m_nofPushed, 0, m_visitor);
+  }
+
+private:
+
+  void flush()
+  {
+    if (m_batch.ends.empty() || m_results.failed()) {
+      return;
+    }
+    m_batch.sequence = m_nofPushed;
+    if (m_queue.push(m_batch)) {
+      ++m_nofPushed;
+    }
+    m_batch = SubgraphBatch<Node>();
+    m_results.deliver(m_nofPushed, m_maxInFlight, m_visitor);
+  }
+
+  BoundedQueue<SubgraphBatch<Node>>& m_queue;
+  PipelineResults<Node>& m_results;
+  Visitor& m_visitor;
+  size_t m_batchSize;
+  size_t m_maxInFlight;
+  size_t m_nofPushed = 0;
+  SubgraphBatch<Node> m_batch;
+};
+
+/**
+ * @brief Closes the queue and joins the workers when leaving the scope, also if an exception is thrown.
+ */
+template<typename Node>
+class WorkerGuard
+{
+public:
+
+  WorkerGuard(BoundedQueue<SubgraphBatch<Node>>& queue)
+    : m_queue(queue) {}
+
+  WorkerGuard(const WorkerGuard&) = delete;
+  WorkerGuard& operator=(const WorkerGuard&) = delete;
+
+  ~WorkerGuard()
+  {
+    join();
+  }
+
+  void join()
+  {
+    m_queue.close();
+    for (std::thread& worker : workers) {
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+  }
+
+  std::vector<std::thread> workers;
+
+private:
+
+  BoundedQueue<SubgraphBatch<Node>>& m_queue;
+};
+
+/**
+ * @brief Perform the enumeration on the calling thread while a pool of worker threads
+ *        evaluates the filter criteria.
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ * @tparam Visitor Type of visitor receiving the accepted subgraphs.
+ *
+ * @param graph The input graph
+ * @param nofThreads Number of worker threads evaluating the filter.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Filter criteria applied to the subgraphs. Called concurrently from all workers.
+ * @param visitor Receives 'emit' for every accepted subgraph on the calling thread.
+ * @param compare The compare function defining a strict total ordering on the nodes of the graph.
+ * @param batchSize Number of subgraphs per batch.
+ * @param queueCapacity Maximum number of batches waiting for evaluation.
+ *
+ * The enumeration emits every subgraph into batches that are passed to the workers through a
+ * bounded queue. The filtered batches are delivered to the visitor in the order of their generation,
+ * which gives the order of \ref visitEnumeration, and at most 'queueCapacity' plus 'nofThreads'
+ * batches are in flight at any time. If the filter throws, the enumeration stops and the first
+ * exception is rethrown after all workers have been joined.
+ */
+template<typename Graph,
+         typename Node,
+         typename FilterFunc,
+         typename Compare,
+         typename Visitor>
+void visitPipelinedEnumeration(
+    const Graph& graph,
+    size_t nofThreads,
+    size_t upper,
+    const FilterFunc& filter,
+    Visitor& visitor,
+    const Compare& compare,
+    size_t batchSize,
+    size_t queueCapacity)
+{
+  nofThreads = std::max<size_t>(nofThreads, 1);
+  queueCapacity = std::max<size_t>(queueCapacity, 1);
+  BoundedQueue<SubgraphBatch<Node>> queue(queueCapacity);
+  PipelineResults<Node> results;
+  WorkerGuard<Node> guard(queue);
+  guard.workers.reserve(nofThreads);
+  for (size_t thread = 0; thread < nofThreads; ++thread) {
+    guard.workers.emplace_back([&queue, &results, &filter]() {
+      SubgraphBatch<Node> batch;
+      std::vector<Node> subgraph;
+      while (queue.pop(batch)) {
+        if (results.failed()) {
+          continue;
+        }
+        try {
+          std::vector<std::vector<Node>> subgraphs;
+          size_t begin = 0;
+          for (size_t end : batch.ends) {
+            subgraph.assign(batch.nodes.begin() + begin, batch.nodes.begin() + end);
+            if (filter(subgraph)) {
+              subgraphs.push_back(subgraph);
+            }
+            begin = end;
+          }
+          results.complete(batch.sequence, std::move(subgraphs));
+        }
+        catch (...) {
+          results.fail(std::current_exception());
+          queue.close();
+        }
+      }
+    });
+  }
+
+  BatchingVisitor<Node, Visitor> batchingVisitor(queue, results, visitor, batchSize, queueCapacity + nofThreads);
+  visitEnumeration<Graph, Node>(graph, upper, NoFilter(), batchingVisitor, compare);
+  batchingVisitor.finish();
+  guard.join();
+  results.rethrow();
+}
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "../CsrGraph.hpp"
+#include "Canonical.hpp"
+#include "Enumeration.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Representative of an orbit of subgraphs under the automorphisms of a graph.
+ *
+ * @tparam Node Type of node contained in the graph.
+ */
+template<typename Node>
+struct OrbitRepresentative
+{
+  std::vector<Node> subgraph; ///< the representative, sorted with respect to the compare function
+  size_t orbitSize;           ///< number of subgraphs the automorphisms map the representative to
+};
+
+namespace Intern {
+
+/**
+ * @brief Enumeration of one connected induced subgraph per orbit under a group of automorphisms.
+ *
+ * Every subgraph is identified with its path in the recursion of CONSENS on the index graph:
+ * its smallest node followed by the nodes in the order in which they are added. The representative
+ * of an orbit is the subgraph with the lexicographically smallest path, which is the first one
+ * the enumeration reaches. A frame is pruned together with its subtree as soon as an automorphism
+ * maps its subgraph to a set whose path is smaller already on the known prefix, because all
+ * supersets in the subtree are mapped to sets with smaller paths as well.
+ *
+ * An automorphism maps a subgraph to a set with a node smaller than the root r if and only if the
+ * subgraph contains a node whose orbit contains such a node. Therefore only the smallest node of
+ * every orbit of nodes is used as root and all nodes of orbits with a smaller node are forbidden
+ * for root r from the start, which decides these cases in constant time per node. The remaining
+ * images have smallest node r if and only if the automorphism maps a node s of the subgraph to r.
+ * These automorphisms are listed per node s once per root, so every frame only compares the paths
+ * of the images under the |G| / |orbit(r)| automorphisms per node of the subgraph in the orbit of r
+ * instead of examining all elements of the group.
+ */
+class OrbitSearch
+{
+public:
+
+  OrbitSearch(
+      const CsrGraph<uint32_t>& graph,
+      const AutomorphismGroup& group)
+    : m_graph(graph),
+      m_group(group),
+      m_orbitMin(graph.nofNodes()),
+      m_inverses(group.elements.size(), std::vector<uint32_t>(graph.nofNodes())),
+      m_firstMapping(graph.nofNodes(), std::numeric_limits<size_t>::max()),
+      m_nextMapping(group.elements.size(), std::numeric_limits<size_t>::max()),
+      m_inImage(graph.nofNodes(), 0),
+      m_reached(graph.nofNodes(), 0),
+      m_stamp(0)
+  {
+    std::iota(m_orbitMin.begin(), m_orbitMin.end(), 0);
+    for (size_t idx = 0; idx < group.elements.size(); ++idx) {
+      const std::vector<uint32_t>& automorphism = group.elements[idx];
+      for (uint32_t node = 0; node < graph.nofNodes(); ++node) {
+        m_orbitMin[node] = std::min(m_orbitMin[node], automorphism[node]);
+        m_inverses[idx][automorphism[node]] = node;
+      }
+    }
+  }
+
+  /**
+   * @brief Enumerate the representatives of the orbits.
+   *
+   * @param upper Upper bound for the size of the subgraphs.
+   * @param filter Filter criteria applied to the representatives.
+   * @param callback Called with every representative fulfilling the filter and its orbit size.
+   */
+  template<typename FilterFunc,
+           typename Callback>
+  void run(
+      size_t upper,
+      const FilterFunc& filter,
+      const Callback& callback)
+  {
+    if (upper == 0) {
+      return;
+    }
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> forbidden;
+    for (uint32_t root = 0; root < m_graph.nofNodes(); ++root) {
+      if (m_orbitMin[root] != root) {
+        continue;
+      }
+      // list the automorphisms mapping a node to the root, skipping the identity
+      for (size_t idx = 1; idx < m_group.elements.size(); ++idx) {
+        uint32_t preimage = m_inverses[idx][root];
+        m_nextMapping[idx] = m_firstMapping[preimage];
+        m_firstMapping[preimage] = idx;
+      }
+      candidates.clear();
+      forbidden.clear();
+      for (uint32_t node = 0; node < m_graph.nofNodes(); ++node) {
+        if (node < root || m_orbitMin[node] < root) {
+          forbidden.push_back(node);
+        }
+      }
+      std::set_difference(m_graph.neighborsBegin(root), m_graph.neighborsEnd(root),
+                          forbidden.begin(), forbidden.end(), std::back_inserter(candidates));
+      std::vector<uint32_t> current({root});
+      std::vector<uint32_t> path({root});
+      generateRecursive(upper, filter, current, path, candidates, forbidden, callback);
+      for (size_t idx = 1; idx < m_group.elements.size(); ++idx) {
+        m_firstMapping[m_inverses[idx][root]] = NONE;
+      }
+    }
+  }
+
+private:
+
+  static constexpr size_t NONE = std::numeric_limits<size_t>::max();
+
+  /**
+   * @brief Compare the path of the image of a subgraph under an automorphism with the path
+   *        of the subgraph.
+   *
+   * @return A negative value if the path of the image is smaller, zero if the automorphism maps
+   *         the subgraph to itself and a positive value otherwise.
+   *
+   * The path of the image is followed only as long as it agrees with 'path', starting at the
+   * smallest node of the image, which must be the first node of 'path', and continuing with its
+   * smallest node adjacent to the nodes already on the path.
+   */
+  int compareImage(
+      const std::vector<uint32_t>& automorphism,
+      const std::vector<uint32_t>& path)
+  {
+    ++m_stamp;
+    for (uint32_t node : path) {
+      m_inImage[automorphism[node]] = m_stamp;
+    }
+    m_frontier.clear();
+    m_reached[path.front()] = m_stamp;
+    for (size_t pos = 0; ; ) {
+      for (auto iter = m_graph.neighborsBegin(path[pos]); iter != m_graph.neighborsEnd(path[pos]); ++iter) {
+        if (m_inImage[*iter] == m_stamp && m_reached[*iter] != m_stamp) {
+          m_reached[*iter] = m_stamp;
+          m_frontier.push_back(*iter);
+          std::push_heap(m_frontier.begin(), m_frontier.end(), std::greater<uint32_t>());
+        }
+      }
+      if (++pos == path.size()) {
+        return 0;
+      }
+      if (m_frontier.empty()) {
+        return 1;
+      }
+      uint32_t next = m_frontier.front();
+      if (next != path[pos]) {
+        return next < path[pos] ? -1 : 1;
+      }
+      std::pop_heap(m_frontier.begin(), m_frontier.end(), std::greater<uint32_t>());
+      m_frontier.pop_back();
+    }
+  }
+
+  template<typename FilterFunc,
+           typename Callback>
+  void generateRecursive(
+      size_t upper,
+      const FilterFunc& filter,
+      std::vector<uint32_t>& current,
+      std::vector<uint32_t>& path,
+      const std::vector<uint32_t>& candidates,
+      const std::vector<uint32_t>& forbidden,
+      const Callback& callback)
+  {
+    size_t stabilizerSize = 1;
+    for (uint32_t node : current) {
+      if (m_orbitMin[node] != path.front()) {
+        continue;
+      }
+      for (size_t idx = m_firstMapping[node]; idx != NONE; idx = m_nextMapping[idx]) {
+        int order = compareImage(m_group.elements[idx], path);
+        if (order < 0) {
+          return;
+        }
+        if (order == 0) {
+          ++stabilizerSize;
+        }
+      }
+    }
+    if (filter(current)) {
+      callback(current, m_group.elements.size() / stabilizerSize);
+    }
+    if (current.size() < upper) {
+      for (auto candidateIter = candidates.cbegin(); candidateIter != candidates.cend(); ++candidateIter) {
+        auto subgraphIter = std::lower_bound(current.begin(), current.end(), *candidateIter);
+        current.insert(subgraphIter, *candidateIter);
+        path.push_back(*candidateIter);
+        std::vector<uint32_t> nextCandidates;
+        std::vector<uint32_t> nextForbidden;
+        updateSetsLinear(m_graph, current, candidates, candidateIter, forbidden, nextCandidates, nextForbidden,
+                         std::less<uint32_t>());
+        generateRecursive(upper, filter, current, path, nextCandidates, nextForbidden, callback);
+        path.pop_back();
+        current.erase(std::lower_bound(current.begin(), current.end(), *candidateIter));
+      }
+    }
+  }
+
+  const CsrGraph<uint32_t>& m_graph;
+  const AutomorphismGroup& m_group;
+  std::vector<uint32_t> m_orbitMin;
+  std::vector<std::vector<uint32_t>> m_inverses;
+  std::vector<size_t> m_firstMapping;
+  std::vector<size_t> m_nextMapping;
+  std::vector<size_t> m_inImage;
+  std::vector<size_t> m_reached;
+  size_t m_stamp;
+  std::vector<uint32_t> m_frontier;
+};
+
+} // end namespace Intern
+} // end namespace ConsensLib
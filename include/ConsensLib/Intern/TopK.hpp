@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "../Types.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Subgraph together with its score.
+ */
+template<typename Node,
+         typename Score>
+struct ScoredSubgraph
+{
+  Score score;
+  std::vector<Node> subgraph;
+};
+
+namespace Intern {
+
+/**
+ * @brief Visitor keeping the k best-scoring emitted subgraphs and pruning subgraphs
+ *        whose bound cannot beat the k-th best score.
+ *
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Score Type of the scores. Must be copyable and comparable by operator<.
+ * @tparam ScoreFunc Type of the score function.
+ * @tparam BoundFunc Type of the bound function.
+ *
+ * The subgraphs are kept in a heap with the worst one at the front. Among subgraphs of equal
+ * score the one emitted first is considered better, so a subgraph only enters a full heap if
+ * its score is strictly larger than the worst one. For the same reason a subgraph is expanded
+ * only if its bound is strictly larger than the worst score of a full heap.
+ */
+template<typename Node,
+         typename Score,
+         typename ScoreFunc,
+         typename BoundFunc>
+class TopKVisitor : public EnumerationVisitor
+{
+public:
+
+  TopKVisitor(
+      size_t k,
+      const ScoreFunc& score,
+      const BoundFunc& bound)
+    : m_k(k),
+      m_score(score),
+      m_bound(bound),
+      m_sequence(0) {}
+
+  void emit(const std::vector<Node>& subgraph)
+  {
+    if (m_k == 0) {
+      return;
+    }
+    Score score = m_score(subgraph);
+    if (m_heap.size() < m_k) {
+      m_heap.push_back(Entry{score, m_sequence++, subgraph});
+      std::push_heap(m_heap.begin(), m_heap.end(), better);
+    }
+    else if (m_heap.front().score < score) {
+      std::pop_heap(m_heap.begin(), m_heap.end(), better);
+      m_heap.back().score = score;
+      m_heap.back().sequence = m_sequence++;
+      m_heap.back().subgraph = subgraph;
+      std::push_heap(m_heap.begin(), m_heap.end(), better);
+    }
+  }
+
+  bool expand(const std::vector<Node>& current, const std::vector<Node>& candidates)
+  {
+    if (m_heap.size() < m_k) {
+      return true;
+    }
+    return !m_heap.empty() && m_heap.front().score < m_bound(current, candidates);
+  }
+
+  /**
+   * @brief The kept subgraphs ordered from the best to the worst score.
+   */
+  std::vector<ScoredSubgraph<Node, Score>> result()
+  {
+    std::sort_heap(m_heap.begin(), m_heap.end(), better);
+    std::vector<ScoredSubgraph<Node, Score>> scored;
+    scored.reserve(m_heap.size());
+    for (Entry& entry : m_heap) {
+      scored.push_back(ScoredSubgraph<Node, Score>{entry.score, std::move(entry.subgraph)});
+    }
+    m_heap.clear();
+    return scored;
+  }
+
+private:
+
+  struct Entry
+  {
+    Score score;
+    size_t sequence;
+    std::vector<Node> subgraph;
+  };
+
+  static bool better(const Entry& e1, const Entry& e2)
+  {
+    if (e2.score < e1.score) {
+      return true;
+    }
+    return !(e1.score < e2.score) && e1.sequence < e2.sequence;
+  }
+
+  size_t m_k;
+  const ScoreFunc& m_score;
+  const BoundFunc& m_bound;
+  size_t m_sequence;
+  std::vector<Entry> m_heap;
+};
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "../GraphTraits.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+template<typename... Types>
+struct MakeVoid
+{
+  using type = void;
+};
+
+template<typename... Types>
+using VoidType = typename MakeVoid<Types...>::type;
+
+template<typename Graph>
+using TraitsNode = typename GraphTraits<Graph>::Node;
+
+/**
+ * @brief Whether the \ref ConsensLib::GraphTraits of 'Graph' provide 'degree(node, graph)'.
+ */
+template<typename Graph, typename = void>
+struct HasDegreeHook : std::false_type {};
+
+template<typename Graph>
+struct HasDegreeHook<Graph, VoidType<decltype(GraphTraits<Graph>::degree(
+    std::declval<const TraitsNode<Graph>&>(), std::declval<const Graph&>()))>> : std::true_type {};
+
+/**
+ * @brief Whether the \ref ConsensLib::GraphTraits of 'Graph' provide 'isAdjacent(node, node, graph)'.
+ */
+template<typename Graph, typename = void>
+struct HasIsAdjacentHook : std::false_type {};
+
+template<typename Graph>
+struct HasIsAdjacentHook<Graph, VoidType<decltype(GraphTraits<Graph>::isAdjacent(
+    std::declval<const TraitsNode<Graph>&>(), std::declval<const TraitsNode<Graph>&>(),
+    std::declval<const Graph&>()))>> : std::true_type {};
+
+/**
+ * @brief Whether the \ref ConsensLib::GraphTraits of 'Graph' provide both 'index(node, graph)' and 'nodeCount(graph)'.
+ */
+template<typename Graph, typename = void>
+struct HasIndexHook : std::false_type {};
+
+template<typename Graph>
+struct HasIndexHook<Graph, VoidType<decltype(GraphTraits<Graph>::index(
+    std::declval<const TraitsNode<Graph>&>(), std::declval<const Graph&>())),
+                                    decltype(GraphTraits<Graph>::nodeCount(std::declval<const Graph&>()))>>
+  : std::true_type {};
+
+/**
+ * @brief Whether the \ref ConsensLib::GraphTraits of 'Graph' provide 'maxDegree(graph)'.
+ */
+template<typename Graph, typename = void>
+struct HasMaxDegreeHook : std::false_type {};
+
+template<typename Graph>
+struct HasMaxDegreeHook<Graph, VoidType<decltype(GraphTraits<Graph>::maxDegree(std::declval<const Graph&>()))>>
+  : std::true_type {};
+
+template<typename Graph,
+         typename Node>
+size_t getDegree(
+    const Node& node,
+    const Graph& graph,
+    std::true_type)
+{
+  return GraphTraits<Graph>::degree(node, graph);
+}
+
+template<typename Graph,
+         typename Node>
+size_t getDegree(
+    const Node& node,
+    const Graph& graph,
+    std::false_type)
+{
+  return static_cast<size_t>(std::distance(GraphTraits<Graph>::adjancencyBegin(node, graph),
+                                           GraphTraits<Graph>::adjancencyEnd(node, graph)));
+}
+
+/**
+ * @brief Degree of a node, given by the 'degree' hook or by iterating over the adjacency list.
+ */
+template<typename Graph,
+         typename Node>
+size_t getDegree(
+    const Node& node,
+    const Graph& graph)
+{
+  return Intern::getDegree(node, graph, HasDegreeHook<Graph>());
+}
+
+template<typename Graph>
+size_t getMaxDegree(
+    const Graph& graph,
+    std::true_type)
+{
+  return GraphTraits<Graph>::maxDegree(graph);
+}
+
+template<typename Graph>
+size_t getMaxDegree(
+    const Graph& graph,
+    std::false_type)
+{
+  size_t maxDegree = 0;
+  for (auto iter = GraphTraits<Graph>::nodesBegin(graph); iter != GraphTraits<Graph>::nodesEnd(graph); ++iter) {
+    maxDegree = std::max(maxDegree, Intern::getDegree(*iter, graph));
+  }
+  return maxDegree;
+}
+
+/**
+ * @brief Maximum degree of the graph, given by the 'maxDegree' hook or by a pass over all nodes.
+ */
+template<typename Graph>
+size_t getMaxDegree(const Graph& graph)
+{
+  return Intern::getMaxDegree(graph, HasMaxDegreeHook<Graph>());
+}
+
+template<typename Graph,
+         typename Node,
+         typename Compare>
+bool areAdjacent(
+    const Node& n1,
+    const Node& n2,
+    const Graph& graph,
+    const Compare& compare,
+    std::true_type)
+{
+  return GraphTraits<Graph>::isAdjacent(n1, n2, graph);
+}
+
+template<typename Graph,
+         typename Node,
+         typename Compare>
+bool areAdjacent(
+    const Node& n1,
+    const Node& n2,
+    const Graph& graph,
+    const Compare& compare,
+    std::false_type)
+{
+  auto begin = GraphTraits<Graph>::adjancencyBegin(n1, graph);
+  auto end = GraphTraits<Graph>::adjancencyEnd(n1, graph);
+  if (GraphTraits<Graph>::listsSorted()) {
+    return std::binary_search(begin, end, n2, compare);
+  }
+  return std::find_if(begin, end, [&](const Node& node) {
+    return !compare(node, n2) && !compare(n2, node);
+  }) != end;
+}
+
+/**
+ * @brief Whether two nodes are adjacent, given by the 'isAdjacent' hook or by searching the adjacency
+ *        list of the first node, with a binary search if the lists are sorted with respect to 'compare'.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+bool areAdjacent(
+    const Node& n1,
+    const Node& n2,
+    const Graph& graph,
+    const Compare& compare)
+{
+  return Intern::areAdjacent(n1, n2, graph, compare, HasIsAdjacentHook<Graph>());
+}
+
+} // end namespace Intern
+} // end namespace ConsensLib
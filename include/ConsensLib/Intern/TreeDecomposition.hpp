@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../CsrGraph.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+/**
+ * @brief Tree decomposition derived from an elimination ordering.
+ *
+ * Bag 'i' belongs to the i-th eliminated node and contains it together with its neighbors
+ * at the time of its elimination, sorted in ascending order. The parent of a bag is the bag
+ * of the first eliminated node among these neighbors, so every child has a smaller index than
+ * its parent. Bags without neighbors are roots, one for each connected component.
+ */
+struct TreeDecomposition
+{
+  static constexpr size_t NO_PARENT = std::numeric_limits<size_t>::max();
+
+  std::vector<std::vector<uint32_t>> bags;
+  std::vector<size_t> parents;
+  size_t width = 0;
+};
+
+/**
+ * @brief Compute a tree decomposition with the minimum degree heuristic.
+ *
+ * @param graph The index graph.
+ * @param maxWidth Maximum width of the decomposition.
+ * @param decomposition Output for the decomposition.
+ *
+ * @return false if the heuristic exceeds 'maxWidth', in which case the decomposition is incomplete.
+ *
+ * Repeatedly eliminates a node of minimum degree and turns its neighbors into a clique.
+ * For trees the width is one and for typical molecular graphs it is at most three.
+ */
+inline bool decomposeGraph(
+    const CsrGraph<uint32_t>& graph,
+    size_t maxWidth,
+    TreeDecomposition& decomposition)
+{
+  uint32_t nofNodes = static_cast<uint32_t>(graph.nofNodes());
+  std::vector<std::vector<uint32_t>> adjacency(nofNodes);
+  std::set<std::pair<size_t, uint32_t>> queue;
+  for (uint32_t node = 0; node < nofNodes; ++node) {
+    adjacency[node].assign(graph.neighborsBegin(node), graph.neighborsEnd(node));
+    queue.emplace(adjacency[node].size(), node);
+  }
+  std::vector<size_t> position(nofNodes, static_cast<size_t>(TreeDecomposition::NO_PARENT));
+  decomposition.bags.clear();
+  decomposition.parents.clear();
+  decomposition.width = 0;
+  std::vector<uint32_t> merged;
+  while (!queue.empty()) {
+    uint32_t node = queue.begin()->second;
+    queue.erase(queue.begin());
+    const std::vector<uint32_t>& neighbors = adjacency[node];
+    if (neighbors.size() > maxWidth) {
+      return false;
+    }
+    decomposition.width = std::max(decomposition.width, neighbors.size());
+    position[node] = decomposition.bags.size();
+    std::vector<uint32_t> bag(neighbors);
+    bag.insert(std::lower_bound(bag.begin(), bag.end(), node), node);
+    decomposition.bags.push_back(std::move(bag));
+    for (uint32_t neighbor : neighbors) {
+      std::vector<uint32_t>& neighborAdjacency = adjacency[neighbor];
+      queue.erase(std::make_pair(neighborAdjacency.size(), neighbor));
+      merged.clear();
+      std::set_union(neighborAdjacency.begin(), neighborAdjacency.end(),
+                     neighbors.begin(), neighbors.end(),
+                     std::back_inserter(merged));
+      merged.erase(std::remove_if(merged.begin(), merged.end(), [node, neighbor](uint32_t other) {
+        return other == node || other == neighbor;
+      }), merged.end());
+      neighborAdjacency.swap(merged);
+      queue.emplace(neighborAdjacency.size(), neighbor);
+    }
+  }
+  decomposition.parents.assign(decomposition.bags.size(), static_cast<size_t>(TreeDecomposition::NO_PARENT));
+  for (size_t idx = 0; idx < decomposition.bags.size(); ++idx) {
+    for (uint32_t node : decomposition.bags[idx]) {
+      if (position[node] > idx && position[node] < decomposition.parents[idx]) {
+        decomposition.parents[idx] = position[node];
+      }
+    }
+  }
+  return true;
+}
+
+} // end namespace Intern
+} // end namespace ConsensLib
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <limits>
+#include <utility>
+
+#include "GraphTraits.hpp"
+#include "Types.hpp"
+#include "Intern/Lattice.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief The connected induced subgraphs of a graph together with their containment lattice.
+ *
+ * @tparam Node Type of node contained in the graph.
+ */
+template<typename Node>
+struct SubgraphLattice
+{
+  /// The subgraphs indexed by their ids, in the order of \ref ConsensLib::runConsens.
+  std::vector<std::vector<Node>> subgraphs;
+  /// Pairs of ids of a parent and a child that consists of the nodes of the parent and one more node.
+  std::vector<std::pair<size_t, size_t>> edges;
+};
+
+/**
+ * @brief Perform the CONSENS algorithm and report the Hasse diagram of the containment lattice
+ *        of the subgraphs while enumerating them
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Visitor Type of visitor receiving the subgraphs and the edges of the lattice.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param visitor Visitor receiving the subgraphs and edges. See \ref ConsensLib::LatticeVisitor.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ *
+ * The subgraphs get the ids 0, 1, ... in the order of \ref ConsensLib::runConsens. The edge to
+ * the subgraph a subgraph is extended from in the recursion is known directly, all other edges are
+ * found through an index of the subgraphs emitted so far, which keeps the nodes of every subgraph.
+ * No filter is applied, since filtering subgraphs would disconnect the lattice.
+ */
+template<typename Graph,
+         typename Visitor,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename Compare = std::less<Node>>
+void runConsensLatticeVisitor(
+    const Graph& graph,
+    Visitor& visitor,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const Compare& compare = Compare())
+{
+  Intern::visitLatticeEnumeration<Graph, Node>(graph, upper, visitor, compare);
+}
+
+/**
+ * @brief Perform the CONSENS algorithm and collect the subgraphs together with their containment lattice
+ *
+ * Same parameters as \ref ConsensLib::runConsensLatticeVisitor.
+ */
+template<typename Graph,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename Compare = std::less<Node>>
+SubgraphLattice<Node> runConsensLattice(
+    const Graph& graph,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const Compare& compare = Compare())
+{
+  struct Collector : public LatticeVisitor
+  {
+    void node(size_t id, const std::vector<Node>& subgraph)
+    {
+      lattice.subgraphs.push_back(subgraph);
+    }
+
+    void edge(size_t parent, size_t child)
+    {
+      lattice.edges.emplace_back(parent, child);
+    }
+
+    SubgraphLattice<Node> lattice;
+  } collector;
+  Intern::visitLatticeEnumeration<Graph, Node>(graph, upper, collector, compare);
+  return std::move(collector.lattice);
+}
+} // end namespace ConsensLib
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <limits>
+
+#include "GraphTraits.hpp"
+#include "Types.hpp"
+#include "Intern/Enumeration.hpp"
+#include "Intern/LevelWise.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Perform the CONSENS algorithm level by level, emitting all subgraphs of one size before
+ *        any larger subgraph
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Visitor Type of visitor receiving the subgraphs and the finished levels.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param visitor Visitor receiving the subgraphs. See \ref ConsensLib::LevelVisitor.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the subgraphs.
+ *               Must accept std::vector<Node> as input and return a boolean.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ * @param maxFrontierBytes Memory bound of the subgraphs of a level waiting to be extended.
+ *                         Beyond it they are spilled to a temporary file, so the enumeration
+ *                         needs about twice this memory in addition to the copy of the graph.
+ *
+ * @return false if the temporary file could not be written or read back. The enumeration then
+ *         stops early, so only part of the subgraphs has been emitted.
+ *
+ * Emits every subgraph fulfilling the filter criteria, sorted with respect to 'compare' and only
+ * valid during the call, and reports 'levelFinished' after all subgraphs of a size, starting with
+ * size one and ending with the largest size up to 'upper' that has any subgraph. The subgraphs of
+ * a level are stored as node indices of their own size each, so the frontier of level s of a graph
+ * with N connected induced subgraphs of size s takes 4 * s * N bytes.
+ */
+template<typename Graph,
+         typename Visitor,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename FilterFunc = NoFilter,
+         typename Compare = std::less<Node>>
+bool runConsensLevelWiseVisitor(
+    const Graph& graph,
+    Visitor& visitor,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare(),
+    size_t maxFrontierBytes = size_t(256) << 20)
+{
+  return Intern::visitLevelWiseEnumeration<Graph, Node>(graph, upper, filter, visitor, compare, maxFrontierBytes);
+}
+
+/**
+ * @brief Perform the CONSENS algorithm level by level and collect the subgraphs ordered by size
+ *
+ * Same parameters as \ref ConsensLib::runConsensLevelWiseVisitor except for the visitor.
+ * The result contains the same node sets as \ref ConsensLib::runConsens, each sorted with respect
+ * to 'compare', ordered by their size.
+ *
+ * @param complete Optional flag set to false if the temporary file failed and the result is
+ *                 incomplete, otherwise set to true.
+ */
+template<typename Graph,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename FilterFunc = NoFilter,
+         typename Compare = std::less<Node>>
+std::vector<std::vector<Node>> runConsensLevelWise(
+    const Graph& graph,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare(),
+    size_t maxFrontierBytes = size_t(256) << 20,
+    bool* complete = nullptr)
+{
+  struct Collector : public LevelVisitor
+  {
+    void emit(const std::vector<Node>& subgraph)
+    {
+      subgraphs.push_back(subgraph);
+    }
+
+    std::vector<std::vector<Node>> subgraphs;
+  } collector;
+  bool succeeded = Intern::visitLevelWiseEnumeration<Graph, Node>(graph, upper, filter, collector, compare, maxFrontierBytes);
+  if (complete != nullptr) {
+    *complete = succeeded;
+  }
+  return std::move(collector.subgraphs);
+}
+} // end namespace ConsensLib
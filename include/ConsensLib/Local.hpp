@@ -0,0 +1,95 @@
+#pragma once
+
+#include <limits>
+
+#include "GraphTraits.hpp"
+#include "Types.hpp"
+#include "Intern/Enumeration.hpp"
+#include "Intern/Local.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Perform the CONSENS algorithm restricted to subgraphs whose nodes are all within
+ *        a given number of hops of their smallest node
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param radius Maximum distance in 'graph' of every node of a subgraph to its smallest node.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the subgraphs.
+ *               Must accept std::vector<Node> as input and return a boolean.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ *
+ * The result contains the subgraphs of \ref ConsensLib::runConsens within the radius in the same order.
+ * For every root only the nodes of its ball are considered as candidates, so the work per root is
+ * bounded by the ball instead of the whole graph.
+ */
+template<typename Graph,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename FilterFunc = NoFilter,
+         typename Compare = std::less<Node>>
+std::vector<std::vector<Node>> runConsensLocal(
+    const Graph& graph,
+    size_t radius,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare())
+{
+  Intern::SubgraphCollector<Node> collector;
+  Intern::visitLocalEnumeration<Graph, Node>(graph, radius, upper, filter, collector, compare);
+  return std::move(collector.subgraphs);
+}
+
+/**
+ * @brief Perform the radius-bounded CONSENS algorithm and report the enumeration as a stream of events
+ *
+ * Same parameters as \ref ConsensLib::runConsensLocal with the visitor of \ref ConsensLib::runConsensVisitor.
+ */
+template<typename Graph,
+         typename Visitor,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename FilterFunc = NoFilter,
+         typename Compare = std::less<Node>>
+void runConsensLocalVisitor(
+    const Graph& graph,
+    Visitor& visitor,
+    size_t radius,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare())
+{
+  Intern::visitLocalEnumeration<Graph, Node>(graph, radius, upper, filter, visitor, compare);
+}
+
+/**
+ * @brief Enumerate the subgraphs of \ref ConsensLib::runConsensLocal with a given smallest node
+ *
+ * @param root Smallest node with respect to 'compare' of all enumerated subgraphs.
+ *
+ * Remaining parameters as in \ref ConsensLib::runConsensLocal. The roots partition the result of
+ * \ref ConsensLib::runConsensLocal and are independent of each other, so they can be scheduled in parallel.
+ */
+template<typename Graph,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename FilterFunc = NoFilter,
+         typename Compare = std::less<Node>>
+std::vector<std::vector<Node>> runConsensLocalRoot(
+    const Graph& graph,
+    const Node& root,
+    size_t radius,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare())
+{
+  Intern::SubgraphCollector<Node> collector;
+  Intern::LocalSearch<Graph, Node, Compare> search(graph, radius, compare);
+  search.run(root, upper, filter, collector);
+  return std::move(collector.subgraphs);
+}
+} // end namespace ConsensLib
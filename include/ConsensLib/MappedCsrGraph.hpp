@@ -0,0 +1,358 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CONSENSLIB_HAS_MMAP 1
+#endif
+
+#include "CsrGraph.hpp"
+#include "GraphTraits.hpp"
+#include "Intern/CountingIterator.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Header of a graph file in compressed sparse row format.
+ *
+ * The header is followed by 'nofNodes' + 1 offsets as uint64_t and 'nofEntries' neighbors as uint32_t,
+ * where the adjacency list of node v consists of the neighbors at positions offsets[v], ..., offsets[v+1] - 1.
+ * Every adjacency list is sorted ascending and the adjacency is symmetric. All numbers are stored in the
+ * byte order of the machine writing the file.
+ */
+struct CsrFileHeader
+{
+  char magic[8];
+  uint64_t nofNodes;
+  uint64_t nofEntries;
+};
+
+constexpr char CSR_FILE_MAGIC[8] = {'C', 'O', 'N', 'S', 'C', 'S', 'R', '1'};
+
+/**
+ * @brief Write a graph to a file in the format described by \ref ConsensLib::CsrFileHeader.
+ *
+ * @param graph The graph to write.
+ * @param path Path of the file, an existing file is overwritten.
+ *
+ * @return Whether the file has been written completely.
+ */
+inline bool writeCsrFile(
+    const CsrGraph<uint32_t>& graph,
+    const std::string& path)
+{
+  std::FILE* file = std::fopen(path.c_str(), "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  CsrFileHeader header;
+  std::memcpy(header.magic, CSR_FILE_MAGIC, sizeof(header.magic));
+  header.nofNodes = graph.nofNodes();
+  header.nofEntries = 2 * graph.nofEdges();
+  bool success = std::fwrite(&header, sizeof(header), 1, file) == 1;
+  uint64_t offset = 0;
+  for (size_t node = 0; success && node <= graph.nofNodes(); ++node) {
+    success = std::fwrite(&offset, sizeof(offset), 1, file) == 1;
+    if (node < graph.nofNodes()) {
+      offset += graph.degree(static_cast<uint32_t>(node));
+    }
+  }
+  if (success && header.nofEntries != 0) {
+    success = std::fwrite(graph.neighborsBegin(0), sizeof(uint32_t), header.nofEntries, file) == header.nofEntries;
+  }
+  return std::fclose(file) == 0 && success;
+}
+
+/**
+ * @brief Convert a text edge list to a graph file in the format described by \ref ConsensLib::CsrFileHeader.
+ *
+ * @param input Edge list with one edge per line given by the indices of its two nodes separated by whitespace.
+ *        Empty lines and lines starting with '#' or '%' are skipped. The graph has the nodes 0, ..., n-1,
+ *        where n-1 is the largest index in the list. Duplicate edges and self loops are ignored.
+ * @param path Path of the file, an existing file is overwritten.
+ *
+ * @return Whether the edge list could be parsed and the file has been written completely.
+ *
+ * The graph is built in memory once, which takes about 24 bytes per edge.
+ */
+inline bool convertEdgeListToCsrFile(
+    std::istream& input,
+    const std::string& path)
+{
+  std::vector<std::pair<uint32_t, uint32_t>> edges;
+  size_t nofNodes = 0;
+  std::string line;
+  while (std::getline(input, line)) {
+    size_t start = line.find_first_not_of(" \t\r");
+    if (start == std::string::npos || line[start] == '#' || line[start] == '%') {
+      continue;
+    }
+    std::istringstream stream(line);
+    unsigned long long first;
+    unsigned long long second;
+    if (!(stream >> first >> second)
+        || first >= std::numeric_limits<uint32_t>::max()
+        || second >= std::numeric_limits<uint32_t>::max()) {
+      return false;
+    }
+    edges.emplace_back(static_cast<uint32_t>(first), static_cast<uint32_t>(second));
+    nofNodes = std::max(nofNodes, static_cast<size_t>(std::max(first, second)) + 1);
+  }
+  return writeCsrFile(CsrGraph<uint32_t>(nofNodes, edges), path);
+}
+
+/**
+ * @brief Read-only graph backed by a memory mapping of a file in the format described by
+ *        \ref ConsensLib::CsrFileHeader.
+ *
+ * Opening only checks the header and the size of the file, so it takes constant time and the
+ * adjacency lists are loaded on demand by the operating system when the enumeration visits them.
+ * The content of the adjacency lists is trusted; \ref validate checks it in one pass over the file
+ * for graphs from untrusted sources. On systems without mmap the file is read into memory.
+ * The matching \ref ConsensLib::GraphTraits are specified below. They provide the optional hooks
+ * except 'maxDegree', which would read all offsets when opening the file.
+ */
+class MappedCsrGraph {
+
+public:
+
+  using IndexType = uint32_t;
+
+  /**
+   * @brief Map the graph stored at 'path'. Check \ref valid before using the graph.
+   */
+  explicit MappedCsrGraph(const std::string& path)
+  {
+    size_t size = 0;
+#ifdef CONSENSLIB_HAS_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return;
+    }
+    struct stat status;
+    if (::fstat(fd, &status) == 0 && static_cast<size_t>(status.st_size) >= sizeof(CsrFileHeader)) {
+      size = static_cast<size_t>(status.st_size);
+      void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapping != MAP_FAILED) {
+        m_mapping = mapping;
+        m_mappingSize = size;
+      }
+    }
+    ::close(fd);
+    if (m_mapping == nullptr) {
+      return;
+    }
+    const char* data = static_cast<const char*>(m_mapping);
+#else
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+      return;
+    }
+    if (std::fseek(file, 0, SEEK_END) == 0) {
+      long end = std::ftell(file);
+      if (end >= static_cast<long>(sizeof(CsrFileHeader))) {
+        size = static_cast<size_t>(end);
+        m_buffer.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+        std::rewind(file);
+        if (std::fread(m_buffer.data(), 1, size, file) != size) {
+          size = 0;
+        }
+      }
+    }
+    std::fclose(file);
+    const char* data = reinterpret_cast<const char*>(m_buffer.data());
+#endif
+    if (size < sizeof(CsrFileHeader)) {
+      return;
+    }
+    CsrFileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, CSR_FILE_MAGIC, sizeof(header.magic)) != 0
+        || header.nofNodes >= std::numeric_limits<uint32_t>::max()
+        || header.nofEntries > (size - sizeof(header)) / sizeof(uint32_t)
+        || (header.nofNodes + 1) * sizeof(uint64_t) + header.nofEntries * sizeof(uint32_t) != size - sizeof(header)) {
+      return;
+    }
+    const uint64_t* offsets = reinterpret_cast<const uint64_t*>(data + sizeof(header));
+    if (offsets[0] != 0 || offsets[header.nofNodes] != header.nofEntries) {
+      return;
+    }
+    m_nofNodes = static_cast<size_t>(header.nofNodes);
+    m_nofEntries = static_cast<size_t>(header.nofEntries);
+    m_offsets = offsets;
+    m_neighbors = reinterpret_cast<const uint32_t*>(offsets + m_nofNodes + 1);
+  }
+
+  MappedCsrGraph(const MappedCsrGraph&) = delete;
+  MappedCsrGraph& operator=(const MappedCsrGraph&) = delete;
+
+  ~MappedCsrGraph()
+  {
+#ifdef CONSENSLIB_HAS_MMAP
+    if (m_mapping != nullptr) {
+      ::munmap(m_mapping, m_mappingSize);
+    }
+#endif
+  }
+
+  /**
+   * @brief Whether the file could be opened and has the expected format.
+   * An invalid graph has no nodes.
+   *
+   * Only the header, the size of the file and the first and last offset are checked,
+   * not the offsets and adjacency lists in between. See \ref validate.
+   */
+  bool valid() const
+  {
+    return m_offsets != nullptr;
+  }
+
+  /**
+   * @brief Whether the graph is valid and its content is consistent: the offsets are monotonic and
+   *        every adjacency list is sorted strictly ascending, without self loops and with neighbors
+   *        less than the number of nodes.
+   *
+   * Reads the whole file once, so it takes O(n + m) time. The symmetry of the adjacency is not checked.
+   * A graph failing the check must not be enumerated, since the adjacency lists are accessed unchecked.
+   */
+  bool validate() const
+  {
+    if (!valid()) {
+      return false;
+    }
+    for (size_t node = 0; node < m_nofNodes; ++node) {
+      if (m_offsets[node] > m_offsets[node + 1]) {
+        return false;
+      }
+      uint32_t previous = std::numeric_limits<uint32_t>::max();
+      for (const uint32_t* iter = neighborsBegin(static_cast<uint32_t>(node)); iter != neighborsEnd(static_cast<uint32_t>(node)); ++iter) {
+        if (*iter >= m_nofNodes || *iter == node
+            || (previous != std::numeric_limits<uint32_t>::max() && *iter <= previous)) {
+          return false;
+        }
+        previous = *iter;
+      }
+    }
+    return true;
+  }
+
+  size_t nofNodes() const
+  {
+    return m_nofNodes;
+  }
+
+  size_t nofEdges() const
+  {
+    return m_nofEntries / 2;
+  }
+
+  size_t degree(uint32_t node) const
+  {
+    return static_cast<size_t>(m_offsets[node + 1] - m_offsets[node]);
+  }
+
+  const uint32_t* neighborsBegin(uint32_t node) const
+  {
+    return m_neighbors + m_offsets[node];
+  }
+
+  const uint32_t* neighborsEnd(uint32_t node) const
+  {
+    return m_neighbors + m_offsets[node + 1];
+  }
+
+  bool isAdjacent(uint32_t n1, uint32_t n2) const
+  {
+    return std::binary_search(neighborsBegin(n1), neighborsEnd(n1), n2);
+  }
+
+private:
+
+#ifdef CONSENSLIB_HAS_MMAP
+  void* m_mapping = nullptr;
+  size_t m_mappingSize = 0;
+#else
+  std::vector<uint64_t> m_buffer;
+#endif
+  size_t m_nofNodes = 0;
+  size_t m_nofEntries = 0;
+  const uint64_t* m_offsets = nullptr;
+  const uint32_t* m_neighbors = nullptr;
+};
+
+template<>
+struct GraphTraits<MappedCsrGraph> {
+  using Node = uint32_t;
+  using Iterator = const uint32_t*;
+  using NodeIterator = Intern::CountingIterator<uint32_t>;
+
+  static Iterator adjancencyBegin(
+      const Node& node,
+      const MappedCsrGraph& graph)
+  {
+    return graph.neighborsBegin(node);
+  }
+
+  static Iterator adjancencyEnd(
+      const Node& node,
+      const MappedCsrGraph& graph)
+  {
+    return graph.neighborsEnd(node);
+  }
+
+  static NodeIterator nodesBegin(const MappedCsrGraph& graph)
+  {
+    return NodeIterator(0);
+  }
+
+  static NodeIterator nodesEnd(const MappedCsrGraph& graph)
+  {
+    return NodeIterator(static_cast<uint32_t>(graph.nofNodes()));
+  }
+
+  static constexpr bool listsSorted() {
+    return true;
+  }
+
+  static size_t degree(
+      const Node& node,
+      const MappedCsrGraph& graph)
+  {
+    return graph.degree(node);
+  }
+
+  static bool isAdjacent(
+      const Node& n1,
+      const Node& n2,
+      const MappedCsrGraph& graph)
+  {
+    return graph.isAdjacent(n1, n2);
+  }
+
+  static size_t index(
+      const Node& node,
+      const MappedCsrGraph& graph)
+  {
+    return node;
+  }
+
+  static size_t nodeCount(const MappedCsrGraph& graph)
+  {
+    return graph.nofNodes();
+  }
+};
+
+} // end namespace ConsensLib
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "GraphTraits.hpp"
+#include "Intern/FilterIterator.hpp"
+#include "Intern/TraitHooks.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Set of the integral nodes 0, ..., n-1 stored as a bitset.
+ *
+ * Used as mask of a \ref ConsensLib::MaskedGraph for graphs with dense integral nodes, where the
+ * membership test is a single inlined word access. Nodes outside of the range are not contained.
+ */
+class NodeBitMask
+{
+public:
+
+  /**
+   * @brief Construct the mask of 'nofNodes' nodes, all contained if 'value' is true and none otherwise.
+   */
+  explicit NodeBitMask(
+      size_t nofNodes = 0,
+      bool value = false)
+    : m_nofNodes(nofNodes),
+      m_words((nofNodes + 63) / 64, value ? ~uint64_t(0) : 0) {}
+
+  /**
+   * @brief Construct the mask of 'nofNodes' nodes containing exactly the given nodes.
+   */
+  template<typename Iterator>
+  NodeBitMask(
+      size_t nofNodes,
+      Iterator begin,
+      Iterator end)
+    : NodeBitMask(nofNodes)
+  {
+    for (Iterator iter = begin; iter != end; ++iter) {
+      set(static_cast<size_t>(*iter));
+    }
+  }
+
+  size_t nofNodes() const
+  {
+    return m_nofNodes;
+  }
+
+  void set(size_t node)
+  {
+    m_words[node >> 6] |= uint64_t(1) << (node & 63);
+  }
+
+  void reset(size_t node)
+  {
+    m_words[node >> 6] &= ~(uint64_t(1) << (node & 63));
+  }
+
+  bool contains(size_t node) const
+  {
+    return node < m_nofNodes && ((m_words[node >> 6] >> (node & 63)) & 1) != 0;
+  }
+
+  bool operator()(size_t node) const
+  {
+    return contains(node);
+  }
+
+private:
+
+  size_t m_nofNodes;
+  std::vector<uint64_t> m_words;
+};
+
+/**
+ * @brief View of the subgraph of a graph induced by the nodes fulfilling a mask.
+ *
+ * @tparam Graph Type of the underlying graph. Must have \ref ConsensLib::GraphTraits specified.
+ * @tparam Mask Type of the mask. Must accept a node and return true if the node belongs to the view.
+ *         By default a \ref ConsensLib::NodeBitMask for dense integral nodes.
+ *
+ * Nothing of the underlying graph is copied. The \ref ConsensLib::GraphTraits of the view skip
+ * the masked nodes while iterating over the nodes and the adjacency lists of the underlying graph,
+ * so the view can be passed to every function of the library and every subgraph enumerated on it
+ * is a connected induced subgraph of the underlying graph consisting of unmasked nodes only.
+ * Sorted adjacency lists stay sorted. The underlying graph is referenced and must outlive the view.
+ *
+ * The traits of the view forward the optional hooks 'index' and 'nodeCount' and 'isAdjacent' if the
+ * traits of the underlying graph provide them. The view keeps the index range of the underlying graph,
+ * so the masked nodes leave unused indices and the enumeration on a view of a graph with the 'index'
+ * hook still runs on dense arrays. Two nodes of the view are adjacent exactly if both fulfill the mask
+ * and are adjacent in the underlying graph. The 'degree' and 'maxDegree' hooks are not forwarded,
+ * since the underlying graph counts the masked neighbors as well.
+ */
+template<typename Graph,
+         typename Mask = NodeBitMask>
+class MaskedGraph
+{
+public:
+
+  MaskedGraph(
+      const Graph& graph,
+      Mask mask)
+    : m_graph(graph),
+      m_mask(std::move(mask)) {}
+
+  const Graph& graph() const
+  {
+    return m_graph;
+  }
+
+  const Mask& mask() const
+  {
+    return m_mask;
+  }
+
+private:
+
+  const Graph& m_graph;
+  Mask m_mask;
+};
+
+/**
+ * @brief Create the view of 'graph' induced by the nodes fulfilling 'mask'.
+ *        See \ref ConsensLib::MaskedGraph.
+ */
+template<typename Graph,
+         typename Mask>
+MaskedGraph<Graph, Mask> makeMaskedGraph(
+    const Graph& graph,
+    Mask mask)
+{
+  return MaskedGraph<Graph, Mask>(graph, std::move(mask));
+}
+
+template<typename Graph,
+         typename Mask>
+struct GraphTraits<MaskedGraph<Graph, Mask>> {
+  using Node = typename GraphTraits<Graph>::Node;
+  using BaseIterator = decltype(GraphTraits<Graph>::adjancencyBegin(std::declval<const Node&>(),
+                                                                    std::declval<const Graph&>()));
+  using BaseNodeIterator = decltype(GraphTraits<Graph>::nodesBegin(std::declval<const Graph&>()));
+  using Iterator = Intern::FilterIterator<BaseIterator, Mask>;
+  using NodeIterator = Intern::FilterIterator<BaseNodeIterator, Mask>;
+
+  static Iterator adjancencyBegin(
+      const Node& node,
+      const MaskedGraph<Graph, Mask>& graph)
+  {
+    return Iterator(GraphTraits<Graph>::adjancencyBegin(node, graph.graph()),
+                    GraphTraits<Graph>::adjancencyEnd(node, graph.graph()),
+                    graph.mask());
+  }
+
+  static Iterator adjancencyEnd(
+      const Node& node,
+      const MaskedGraph<Graph, Mask>& graph)
+  {
+    BaseIterator end = GraphTraits<Graph>::adjancencyEnd(node, graph.graph());
+    return Iterator(end, end, graph.mask());
+  }
+
+  static NodeIterator nodesBegin(const MaskedGraph<Graph, Mask>& graph)
+  {
+    return NodeIterator(GraphTraits<Graph>::nodesBegin(graph.graph()),
+                        GraphTraits<Graph>::nodesEnd(graph.graph()),
+                        graph.mask());
+  }
+
+  static NodeIterator nodesEnd(const MaskedGraph<Graph, Mask>& graph)
+  {
+    BaseNodeIterator end = GraphTraits<Graph>::nodesEnd(graph.graph());
+    return NodeIterator(end, end, graph.mask());
+  }
+
+  static constexpr bool listsSorted() {
+    return GraphTraits<Graph>::listsSorted();
+  }
+
+  template<typename Base = Graph,
+           typename = typename std::enable_if<Intern::HasIsAdjacentHook<Base>::value>::type>
+  static bool isAdjacent(
+      const Node& n1,
+      const Node& n2,
+      const MaskedGraph<Graph, Mask>& graph)
+  {
+    return graph.mask()(n1) && graph.mask()(n2) && GraphTraits<Graph>::isAdjacent(n1, n2, graph.graph());
+  }
+
+  template<typename Base = Graph,
+           typename = typename std::enable_if<Intern::HasIndexHook<Base>::value>::type>
+  static size_t index(
+      const Node& node,
+      const MaskedGraph<Graph, Mask>& graph)
+  {
+    return GraphTraits<Graph>::index(node, graph.graph());
+  }
+
+  template<typename Base = Graph,
+           typename = typename std::enable_if<Intern::HasIndexHook<Base>::value>::type>
+  static size_t nodeCount(const MaskedGraph<Graph, Mask>& graph)
+  {
+    return GraphTraits<Graph>::nodeCount(graph.graph());
+  }
+};
+
+} // end namespace ConsensLib
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <limits>
+
+#include "GraphTraits.hpp"
+#include "Intern/Maximal.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Enumerate only the inclusion-maximal connected induced subgraphs fulfilling a hereditary predicate
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Predicate Type of the hereditary predicate.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param predicate Predicate the subgraphs have to fulfill. Must accept std::vector<Node> as input
+ *                  and return a boolean. It must be hereditary, i.e. every connected induced
+ *                  subgraph of a subgraph fulfilling the predicate has to fulfill it as well.
+ *                  Examples are induced paths, trees, cliques or bounded degree.
+ * @param upper Optional upper bound for the size of the subgraphs. Subgraphs of this size are maximal.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ *
+ * The maximality is decided during the enumeration: the subtree of a subgraph violating the
+ * predicate is pruned, and a subgraph is reported if no neighboring node extends it to a subgraph
+ * fulfilling the predicate. The result equals the result of \ref ConsensLib::runConsens with the
+ * predicate as filter after removing all subgraphs contained in another one, in the same order.
+ */
+template<typename Graph,
+         typename Predicate,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename Compare = std::less<Node>>
+std::vector<std::vector<Node>> runConsensMaximal(
+    const Graph& graph,
+    const Predicate& predicate,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const Compare& compare = Compare())
+{
+  Intern::SubgraphCollector<Node> collector;
+  Intern::visitMaximalEnumeration<Graph, Node>(graph, upper, predicate, collector, compare);
+  return std::move(collector.subgraphs);
+}
+} // end namespace ConsensLib
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <limits>
+
+#include "GraphTraits.hpp"
+#include "Types.hpp"
+#include "Intern/Ordering.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Perform the CONSENS algorithm in the node order of a heuristic ordering strategy
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param order Strategy for the order of the nodes used by the enumeration. See \ref ConsensLib::NodeOrder.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the subgraphs.
+ *               Must accept std::vector<Node> as input and return a boolean.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ * @param seed Seed for \ref ConsensLib::NodeOrder::RANDOM.
+ *
+ * The order of the nodes decides which root owns which subgraphs and how large the sets of
+ * candidates and forbidden nodes grow, and therefore influences the run-time considerably.
+ * The graph is copied once into an internal index graph relabeled by the chosen strategy
+ * and the enumeration is performed on the copy. The result contains the same node sets as
+ * \ref ConsensLib::runConsens, each sorted with respect to 'compare', but in a different order.
+ */
+template<typename Graph,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename FilterFunc = NoFilter,
+         typename Compare = std::less<Node>>
+std::vector<std::vector<Node>> runConsensOrdered(
+    const Graph& graph,
+    NodeOrder order,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare(),
+    unsigned seed = 0)
+{
+  Intern::SubgraphCollector<Node> collector;
+  Intern::visitOrderedEnumeration<Graph, Node>(graph, order, upper, filter, collector, compare, seed);
+  return std::move(collector.subgraphs);
+}
+} // end namespace ConsensLib
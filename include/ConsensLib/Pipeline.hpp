@@ -0,0 +1,88 @@
+#pragma once
+
+#include <limits>
+#include <thread>
+
+#include "GraphTraits.hpp"
+#include "Types.hpp"
+#include "Intern/Pipeline.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Perform the CONSENS algorithm with the filter criteria evaluated in parallel
+ *        by a pool of worker threads and pass the accepted subgraphs to a visitor
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Visitor Type of visitor receiving the accepted subgraphs.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param visitor Receives 'emit' for every subgraph fulfilling the filter criteria. It is called on the
+ *                calling thread; the other events of \ref ConsensLib::EnumerationVisitor are not reported.
+ * @param filter Filter criteria applied to the subgraphs.
+ *               Must accept std::vector<Node> as input and return a boolean.
+ *               It is called concurrently from all worker threads and must therefore be thread-safe.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ * @param nofThreads Number of worker threads. By default one per hardware thread.
+ * @param batchSize Number of subgraphs passed to a worker at once.
+ * @param queueCapacity Maximum number of batches waiting for a worker.
+ *
+ * Useful if the filter is considerably more expensive than the enumeration itself.
+ * The enumeration runs on the calling thread and pushes batches of subgraphs into a bounded queue
+ * from which the workers take them for evaluation. The accepted subgraphs are passed to the visitor
+ * in the order of \ref ConsensLib::runConsens. The enumeration waits while the queue is full or
+ * 'queueCapacity' plus 'nofThreads' batches are neither delivered nor evaluated, so the memory in use
+ * is bounded independently of the number of subgraphs. Idle threads sleep instead of spinning.
+ * If the filter throws, the enumeration stops and the exception is rethrown on the calling thread
+ * after all workers have finished.
+ */
+template<typename Graph,
+         typename Visitor,
+         typename FilterFunc,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename Compare = std::less<Node>>
+void runConsensPipelinedVisitor(
+    const Graph& graph,
+    Visitor& visitor,
+    const FilterFunc& filter,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const Compare& compare = Compare(),
+    size_t nofThreads = std::thread::hardware_concurrency(),
+    size_t batchSize = 256,
+    size_t queueCapacity = 64)
+{
+  Intern::visitPipelinedEnumeration<Graph, Node>(graph, nofThreads, upper, filter, visitor, compare,
+                                                 batchSize, queueCapacity);
+}
+
+/**
+ * @brief Perform the CONSENS algorithm with the filter criteria evaluated in parallel
+ *        by a pool of worker threads
+ *
+ * Same parameters as \ref ConsensLib::runConsensPipelinedVisitor.
+ * The result is identical to the one of \ref ConsensLib::runConsens including its order.
+ */
+template<typename Graph,
+         typename FilterFunc,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename Compare = std::less<Node>>
+std::vector<std::vector<Node>> runConsensPipelined(
+    const Graph& graph,
+    const FilterFunc& filter,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const Compare& compare = Compare(),
+    size_t nofThreads = std::thread::hardware_concurrency(),
+    size_t batchSize = 256,
+    size_t queueCapacity = 64)
+{
+  Intern::SubgraphCollector<Node> collector;
+  Intern::visitPipelinedEnumeration<Graph, Node>(graph, nofThreads, upper, filter, collector, compare,
+                                                 batchSize, queueCapacity);
+  return std::move(collector.subgraphs);
+}
+} // end namespace ConsensLib
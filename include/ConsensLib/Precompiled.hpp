@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "Consens.hpp"
+#include "CsrGraph.hpp"
+#include "Types.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+// The enumeration of dense integer graphs is instantiated once in the precompiled library. CsrGraph provides the
+// 'index' hook, so the dispatching overload of visitEnumeration runs the recursion of IndexedGenerator.
+extern template void visitEnumeration<CsrGraph<uint16_t>, uint16_t, NoFilter, std::less<uint16_t>,
+                                      SubgraphCollector<uint16_t>>(
+    const CsrGraph<uint16_t>&, size_t, const NoFilter&, SubgraphCollector<uint16_t>&, const std::less<uint16_t>&);
+
+extern template void visitEnumeration<CsrGraph<uint32_t>, uint32_t, NoFilter, std::less<uint32_t>,
+                                      SubgraphCollector<uint32_t>>(
+    const CsrGraph<uint32_t>&, size_t, const NoFilter&, SubgraphCollector<uint32_t>&, const std::less<uint32_t>&);
+
+extern template void visitEnumeration<CsrGraph<uint16_t>, uint16_t, NoFilter, std::less<uint16_t>,
+                                      SubgraphCollector<uint16_t>>(
+    const CsrGraph<uint16_t>&, const std::vector<uint16_t>&, size_t, const NoFilter&, SubgraphCollector<uint16_t>&,
+    const std::less<uint16_t>&, std::true_type);
+
+extern template void visitEnumeration<CsrGraph<uint32_t>, uint32_t, NoFilter, std::less<uint32_t>,
+                                      SubgraphCollector<uint32_t>>(
+    const CsrGraph<uint32_t>&, const std::vector<uint32_t>&, size_t, const NoFilter&, SubgraphCollector<uint32_t>&,
+    const std::less<uint32_t>&, std::true_type);
+
+extern template std::vector<std::vector<uint16_t>> runEnumeration<CsrGraph<uint16_t>, uint16_t, NoFilter,
+                                                                  std::less<uint16_t>>(
+    const CsrGraph<uint16_t>&, size_t, const NoFilter&, const std::less<uint16_t>&);
+
+extern template std::vector<std::vector<uint32_t>> runEnumeration<CsrGraph<uint32_t>, uint32_t, NoFilter,
+                                                                  std::less<uint32_t>>(
+    const CsrGraph<uint32_t>&, size_t, const NoFilter&, const std::less<uint32_t>&);
+
+} // end namespace Intern
+
+/**
+ * @brief Non-template interface of the precompiled library target ConsensLib::Engine.
+ *
+ * The library is built with its own optimization flags (and link time optimization
+ * where supported) independent of the consumer. Translation units using this interface
+ * neither instantiate nor optimize the enumeration themselves. Calls of the templates
+ * in \ref Consens.hpp for \ref ConsensLib::CsrGraph with 16 or 32 bit indices, the default filter
+ * and compare function resolve to the precompiled instantiations as well.
+ * Graphs with custom traits keep using the header-only templates.
+ */
+namespace Precompiled {
+
+/**
+ * @brief Enumerate the node sets of all connected induced subgraphs with at most 'upper' nodes.
+ *        See \ref ConsensLib::runConsens.
+ */
+std::vector<std::vector<uint16_t>> runConsens(
+    const CsrGraph<uint16_t>& graph,
+    size_t upper = std::numeric_limits<size_t>::max());
+
+/**
+ * @brief Enumerate the node sets of all connected induced subgraphs with at most 'upper' nodes.
+ *        See \ref ConsensLib::runConsens.
+ */
+std::vector<std::vector<uint32_t>> runConsens(
+    const CsrGraph<uint32_t>& graph,
+    size_t upper = std::numeric_limits<size_t>::max());
+
+/**
+ * @brief Enumerate the node sets of all connected induced subgraphs in the order of an ordering strategy.
+ *        See \ref ConsensLib::runConsensOrdered.
+ */
+std::vector<std::vector<uint16_t>> runConsensOrdered(
+    const CsrGraph<uint16_t>& graph,
+    NodeOrder order,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    unsigned seed = 0);
+
+/**
+ * @brief Enumerate the node sets of all connected induced subgraphs in the order of an ordering strategy.
+ *        See \ref ConsensLib::runConsensOrdered.
+ */
+std::vector<std::vector<uint32_t>> runConsensOrdered(
+    const CsrGraph<uint32_t>& graph,
+    NodeOrder order,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    unsigned seed = 0);
+
+/**
+ * @brief Count the connected induced subgraphs per number of nodes.
+ *        See \ref ConsensLib::countConsens.
+ */
+std::vector<size_t> countConsens(
+    const CsrGraph<uint16_t>& graph,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    size_t maxWidth = 6);
+
+/**
+ * @brief Count the connected induced subgraphs per number of nodes.
+ *        See \ref ConsensLib::countConsens.
+ */
+std::vector<size_t> countConsens(
+    const CsrGraph<uint32_t>& graph,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    size_t maxWidth = 6);
+
+} // end namespace Precompiled
+} // end namespace ConsensLib
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "GraphTraits.hpp"
+#include "Types.hpp"
+#include "Intern/Canonical.hpp"
+#include "Intern/IndexGraph.hpp"
+#include "Intern/Symmetry.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Perform the CONSENS algorithm enumerating one subgraph per orbit under the automorphisms
+ *        of the graph
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the representatives.
+ *               Must accept std::vector<Node> as input and return a boolean.
+ *               Should give the same answer for all subgraphs of an orbit, e.g. by only
+ *               depending on the structure of the subgraph.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ * @param maxGroupSize Maximum number of automorphisms used for the reduction.
+ *
+ * Computes the automorphism group of the graph by individualization-refinement and enumerates
+ * for every orbit of connected induced subgraphs the one that \ref ConsensLib::runConsens
+ * generates first, together with the size of its orbit. Roots and branches whose subgraphs are
+ * all mapped to earlier ones are pruned, so the number of visited subgraphs drops roughly by the
+ * order of the group. Each visited subgraph is compared only with its images under the automorphisms
+ * mapping one of its nodes to its smallest node, which are |G| / |orbit(r)| per node in the orbit of
+ * the smallest node r, not with all |G| images.
+ * The elements of the group are stored explicitly and computing them can take longer than the
+ * enumeration on large graphs. If the group has more than 'maxGroupSize' elements, only the
+ * stabilizer of some nodes is used, which yields one representative per orbit of that subgroup.
+ */
+template<typename Graph,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename FilterFunc = NoFilter,
+         typename Compare = std::less<Node>>
+std::vector<OrbitRepresentative<Node>> runConsensOrbits(
+    const Graph& graph,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare(),
+    size_t maxGroupSize = 4096)
+{
+  Intern::IndexGraph<Node> indexGraph = Intern::buildIndexGraph<Graph, Node>(graph, compare);
+  Intern::AutomorphismGroup group = Intern::enumerateAutomorphisms(indexGraph.graph, maxGroupSize);
+  Intern::MappedFilter<Node, FilterFunc, Compare> mappedFilter(indexGraph.nodes, filter, compare);
+  std::vector<OrbitRepresentative<Node>> result;
+  Intern::OrbitSearch search(indexGraph.graph, group);
+  search.run(upper, mappedFilter, [&](const std::vector<uint32_t>& subgraph, size_t orbitSize) {
+    result.push_back(OrbitRepresentative<Node>{std::vector<Node>(), orbitSize});
+    Intern::mapSubgraph(subgraph, indexGraph.nodes, result.back().subgraph, compare);
+  });
+  return result;
+}
+} // end namespace ConsensLib
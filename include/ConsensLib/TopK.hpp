@@ -0,0 +1,65 @@
+#pragma once
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "GraphTraits.hpp"
+#include "Types.hpp"
+#include "Intern/Enumeration.hpp"
+#include "Intern/TopK.hpp"
+
+namespace ConsensLib {
+
+/**
+ * @brief Perform the CONSENS algorithm keeping only the k subgraphs of best score
+ *        and prune the recursion by branch-and-bound
+ *
+ * @tparam Graph Type of graph for enumeration.
+ * @tparam ScoreFunc Type of the score function.
+ * @tparam BoundFunc Type of the bound function.
+ * @tparam Node Type of node contained in the graph.
+ * @tparam FilterFunc Type of filter for the option of filtering the generated node sets.
+ * @tparam Compare Type of compare function that defines a strict total ordering in the nodes.
+ *
+ * @param graph Input graph
+ * @param k Number of subgraphs to keep.
+ * @param score Score of a subgraph. Must accept std::vector<Node> as input and return a value
+ *              comparable by operator<. Larger scores are better.
+ * @param bound Optimistic bound of a subgraph. Must accept the currently considered subgraph and its
+ *              candidates, both as std::vector<Node>, and return a value of the score type that is
+ *              not smaller than the score of any connected super graph avoiding the forbidden nodes,
+ *              i.e. of every subgraph enumerated below the current one.
+ *              It is only evaluated once k subgraphs are kept.
+ * @param upper Optional upper bound for the size of the subgraphs.
+ * @param filter Optional filter criteria applied to the subgraphs before they are scored.
+ *               Must accept std::vector<Node> as input and return a boolean.
+ * @param compare Compare function defining a strict total ordering on the nodes of the graph.
+ *                By default std::less is used
+ *
+ * Keeps the k best subgraphs seen so far in a heap. As soon as it is full, the super graphs of a
+ * subgraph are only enumerated if its bound is larger than the k-th best score. The result is
+ * ordered from the best to the worst score; subgraphs of equal score are ordered as in the
+ * result of \ref ConsensLib::runConsens, which also decides the ties at the k-th position.
+ */
+template<typename Graph,
+         typename ScoreFunc,
+         typename BoundFunc,
+         typename Node = typename GraphTraits<Graph>::Node,
+         typename FilterFunc = NoFilter,
+         typename Compare = std::less<Node>,
+         typename Score = typename std::decay<decltype(std::declval<const ScoreFunc&>()(std::declval<const std::vector<Node>&>()))>::type>
+std::vector<ScoredSubgraph<Node, Score>> runConsensTopK(
+    const Graph& graph,
+    size_t k,
+    const ScoreFunc& score,
+    const BoundFunc& bound,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare())
+{
+  Intern::TopKVisitor<Node, Score, ScoreFunc, BoundFunc> visitor(k, score, bound);
+  Intern::visitEnumeration<Graph, Node>(graph, upper, filter, visitor, compare);
+  return visitor.result();
+}
+} // end namespace ConsensLib
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 namespace ConsensLib {
@@ -16,4 +17,106 @@ struct NoFilter
     return true;
   }
 };
+
+/**
+ * @brief Strategies for the order of the nodes in which the enumeration is performed.
+ *
+ * The order decides which root owns which subgraphs and therefore how large the candidate and
+ * forbidden sets grow during the recursion. It does not change the enumerated node sets.
+ */
+enum class NodeOrder {
+  COMPARE,           ///< the order given by the compare function
+  DEGREE_DESCENDING, ///< nodes with many neighbors first
+  DEGENERACY,        ///< removal order of repeatedly removing a node of minimum degree, i.e. the reverse smallest-last order
+  CUTHILL_MCKEE,     ///< breadth-first search from a node of minimum degree visiting neighbors by ascending degree
+  RANDOM             ///< uniformly random order
+};
+
+/**
+ * @brief Algorithms enumerating the connected induced subgraphs.
+ *
+ * All algorithms enumerate the same node sets, but in different orders and with different costs
+ * per subgraph depending on the size and density of the graph and on the upper bound.
+ */
+enum class EnumerationAlgorithm {
+  AUTO,           ///< CONSENS with the 'index' trait hook, otherwise chosen from the number of nodes, edges, the maximum degree and the upper bound
+  CONSENS,        ///< recursion on sorted candidate and forbidden sets
+  SIMPLE,         ///< recursion of CONSENS on dense node states instead of sorted sets
+  ESU,            ///< extension by exclusive neighbors of Wernicke's ESU algorithm
+  REVERSE_SEARCH  ///< reverse search removing the largest node that keeps the subgraph connected
+};
+
+/**
+ * @brief The default visitor ignoring all enumeration events.
+ * Custom visitors should derive from it and hide the events they are interested in.
+ *
+ * The enumeration reports 'push' when a node is added to the currently considered subgraph,
+ * 'pop' when it is removed again and 'emit' when the currently considered subgraph
+ * fulfills the filter criteria. Consecutive subgraphs therefore differ by the nodes
+ * pushed and popped in between, which allows to maintain incremental state.
+ * Before the super graphs of the currently considered subgraph are enumerated, 'expand'
+ * is asked with the subgraph and its candidates; returning false prunes all of them.
+ */
+struct EnumerationVisitor
+{
+  template<typename Node>
+  void push(const Node& node)
+  {
+  }
+
+  template<typename Node>
+  void pop(const Node& node)
+  {
+  }
+
+  template<typename Node>
+  void emit(const std::vector<Node>& subgraph)
+  {
+  }
+
+  template<typename Node>
+  bool expand(const std::vector<Node>& current, const std::vector<Node>& candidates)
+  {
+    return true;
+  }
+};
+
+/**
+ * @brief The default visitor of the enumeration ordered by size ignoring all events.
+ * Custom visitors should derive from it and hide the events they are interested in.
+ *
+ * The enumeration reports 'emit' for every subgraph fulfilling the filter criteria and
+ * 'levelFinished' with a size as soon as all subgraphs of that size have been emitted.
+ */
+struct LevelVisitor
+{
+  template<typename Node>
+  void emit(const std::vector<Node>& subgraph)
+  {
+  }
+
+  void levelFinished(size_t size)
+  {
+  }
+};
+
+/**
+ * @brief The default visitor of the subgraph lattice ignoring all events.
+ * Custom visitors should derive from it and hide the events they are interested in.
+ *
+ * The enumeration reports 'node' with the consecutive id of every subgraph and 'edge' for every
+ * pair of subgraphs where the child consists of the nodes of the parent and one additional node.
+ * An edge is reported directly after the later of its two subgraphs, so both ids are known by then.
+ */
+struct LatticeVisitor
+{
+  template<typename Node>
+  void node(size_t id, const std::vector<Node>& subgraph)
+  {
+  }
+
+  void edge(size_t parent, size_t child)
+  {
+  }
+};
 } // end namespace ConsensLib
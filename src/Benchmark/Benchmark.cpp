@@ -0,0 +1,309 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ConsensLib/Algorithms.hpp"
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/CsrGraph.hpp"
+#include "ConsensLib/Ordering.hpp"
+
+using Graph = ConsensLib::CsrGraph<uint32_t>;
+using EdgeList = std::vector<std::pair<uint32_t, uint32_t>>;
+
+// plain adjacency lists whose traits provide none of the optional hooks
+struct AdjacencyGraph {
+  explicit AdjacencyGraph(const Graph& graph)
+    : adjacency(graph.nofNodes())
+  {
+    for (uint32_t node = 0; node < graph.nofNodes(); ++node) {
+      nodes.push_back(node);
+      adjacency[node].assign(graph.neighborsBegin(node), graph.neighborsEnd(node));
+    }
+  }
+
+  std::vector<uint32_t> nodes;
+  std::vector<std::vector<uint32_t>> adjacency;
+};
+
+namespace ConsensLib {
+
+template<>
+struct GraphTraits<AdjacencyGraph> {
+  using Node = uint32_t;
+  using Iterator = std::vector<uint32_t>::const_iterator;
+
+  static Iterator adjancencyBegin(
+      const Node& node,
+      const AdjacencyGraph& graph)
+  {
+    return graph.adjacency[node].begin();
+  }
+
+  static Iterator adjancencyEnd(
+      const Node& node,
+      const AdjacencyGraph& graph)
+  {
+    return graph.adjacency[node].end();
+  }
+
+  static Iterator nodesBegin(const AdjacencyGraph& graph)
+  {
+    return graph.nodes.begin();
+  }
+
+  static Iterator nodesEnd(const AdjacencyGraph& graph)
+  {
+    return graph.nodes.end();
+  }
+
+  static constexpr bool listsSorted() {
+    return true;
+  }
+};
+}
+
+struct BenchmarkGraph {
+  std::string name;
+  Graph graph;
+  size_t upper;
+};
+
+Graph getGrid(uint32_t width, uint32_t height)
+{
+  EdgeList edges;
+  for (uint32_t y = 0; y < height; ++y) {
+    for (uint32_t x = 0; x < width; ++x) {
+      uint32_t idx = y * width + x;
+      if (x + 1 < width) {
+        edges.emplace_back(idx, idx + 1);
+      }
+      if (y + 1 < height) {
+        edges.emplace_back(idx, idx + width);
+      }
+    }
+  }
+  return Graph(width * height, edges);
+}
+
+Graph getRandomTree(uint32_t nofNodes, unsigned seed)
+{
+  std::mt19937 generator(seed);
+  EdgeList edges;
+  for (uint32_t idx = 1; idx < nofNodes; ++idx) {
+    std::uniform_int_distribution<uint32_t> parent(0, idx - 1);
+    edges.emplace_back(parent(generator), idx);
+  }
+  return Graph(nofNodes, edges);
+}
+
+Graph getRandomGraph(uint32_t nofNodes, double probability, unsigned seed)
+{
+  std::mt19937 generator(seed);
+  std::bernoulli_distribution coin(probability);
+  EdgeList edges;
+  for (uint32_t i = 0; i < nofNodes; ++i) {
+    for (uint32_t j = i + 1; j < nofNodes; ++j) {
+      if (coin(generator)) {
+        edges.emplace_back(i, j);
+      }
+    }
+  }
+  return Graph(nofNodes, edges);
+}
+
+// a chain of fused six-membered rings with short side chains, labeled in a scrambled order
+Graph getFusedRings(uint32_t nofRings, unsigned seed)
+{
+  EdgeList edges;
+  uint32_t nofNodes = 4 * nofRings + 2;
+  for (uint32_t ring = 0; ring < nofRings; ++ring) {
+    uint32_t a = 4 * ring;
+    edges.emplace_back(a, a + 1);
+    edges.emplace_back(a + 1, a + 2);
+    edges.emplace_back(a + 2, a + 4);
+    edges.emplace_back(a, a + 3);
+    edges.emplace_back(a + 3, a + 5);
+    edges.emplace_back(a + 4, a + 5);
+  }
+  for (uint32_t ring = 0; ring < nofRings; ring += 2) {
+    edges.emplace_back(4 * ring + 1, nofNodes);
+    edges.emplace_back(nofNodes, nofNodes + 1);
+    nofNodes += 2;
+  }
+  std::vector<uint32_t> label(nofNodes);
+  for (uint32_t idx = 0; idx < nofNodes; ++idx) {
+    label[idx] = idx;
+  }
+  std::mt19937 generator(seed);
+  std::shuffle(label.begin(), label.end(), generator);
+  for (std::pair<uint32_t, uint32_t>& edge : edges) {
+    edge = std::make_pair(label[edge.first], label[edge.second]);
+  }
+  return Graph(nofNodes, edges);
+}
+
+struct CountingVisitor : public ConsensLib::EnumerationVisitor {
+  void emit(const std::vector<uint32_t>& subgraph)
+  {
+    ++count;
+  }
+
+  size_t count = 0;
+};
+
+template<typename Func>
+double measureMilliseconds(const Func& func, unsigned repetitions = 3)
+{
+  double best = 0.0;
+  for (unsigned i = 0; i < repetitions; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto stop = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double, std::milli>(stop - start).count();
+    if (i == 0 || elapsed < best) {
+      best = elapsed;
+    }
+  }
+  return best;
+}
+
+std::vector<BenchmarkGraph> getBenchmarkGraphs()
+{
+  std::vector<BenchmarkGraph> graphs;
+  graphs.push_back({"tree n=80", getRandomTree(80, 1), 9});
+  graphs.push_back({"grid 7x7", getGrid(7, 7), 8});
+  graphs.push_back({"ladder 2x40", getGrid(40, 2), 12});
+  graphs.push_back({"fused rings", getFusedRings(14, 5), 12});
+  graphs.push_back({"sparse G(80,0.05)", getRandomGraph(80, 0.05, 3), 7});
+  graphs.push_back({"dense G(24,0.5)", getRandomGraph(24, 0.5, 4), 6});
+  return graphs;
+}
+
+void benchmarkNodeOrders(const std::vector<BenchmarkGraph>& graphs)
+{
+  const std::vector<std::pair<std::string, ConsensLib::NodeOrder>> orders = {
+    {"compare", ConsensLib::NodeOrder::COMPARE},
+    {"degree", ConsensLib::NodeOrder::DEGREE_DESCENDING},
+    {"degeneracy", ConsensLib::NodeOrder::DEGENERACY},
+    {"cuthill", ConsensLib::NodeOrder::CUTHILL_MCKEE},
+    {"random", ConsensLib::NodeOrder::RANDOM}
+  };
+
+  std::cout << "--NODE ORDERS-- (milliseconds)\n\n" << std::left << std::setw(20) << "graph"
+            << std::setw(12) << "subgraphs";
+  for (const auto& order : orders) {
+    std::cout << std::setw(12) << order.first;
+  }
+  std::cout << "best\n";
+  for (const BenchmarkGraph& benchmarkGraph : graphs) {
+    CountingVisitor counter;
+    ConsensLib::runConsensVisitor(benchmarkGraph.graph, counter, benchmarkGraph.upper);
+    std::cout << std::setw(20) << benchmarkGraph.name << std::setw(12) << counter.count;
+    std::string best;
+    double bestTime = 0.0;
+    for (const auto& order : orders) {
+      double elapsed = measureMilliseconds([&]() {
+        CountingVisitor visitor;
+        ConsensLib::Intern::visitOrderedEnumeration<Graph, uint32_t>(
+            benchmarkGraph.graph, order.second, benchmarkGraph.upper, ConsensLib::NoFilter(),
+            visitor, std::less<uint32_t>(), 0);
+      });
+      if (best.empty() || elapsed < bestTime) {
+        best = order.first;
+        bestTime = elapsed;
+      }
+      std::cout << std::setw(12) << std::fixed << std::setprecision(1) << elapsed;
+    }
+    std::cout << best << "\n";
+  }
+  std::cout << std::endl;
+}
+
+std::vector<BenchmarkGraph> getAlgorithmGraphs()
+{
+  std::vector<BenchmarkGraph> graphs = getBenchmarkGraphs();
+  graphs.push_back({"tree n=5000", getRandomTree(5000, 6), 5});
+  graphs.push_back({"grid 60x60", getGrid(60, 60), 6});
+  graphs.push_back({"sparse G(3000,0.001)", getRandomGraph(3000, 0.001, 7), 5});
+  graphs.push_back({"G(400,0.02)", getRandomGraph(400, 0.02, 8), 5});
+  graphs.push_back({"dense G(40,0.5)", getRandomGraph(40, 0.5, 9), 4});
+  graphs.push_back({"dense G(16,0.5)", getRandomGraph(16, 0.5, 10), 16});
+  graphs.push_back({"clique 18", getRandomGraph(18, 1.0, 11), 18});
+  return graphs;
+}
+
+std::string getAlgorithmName(ConsensLib::EnumerationAlgorithm algorithm)
+{
+  switch (algorithm) {
+  case ConsensLib::EnumerationAlgorithm::CONSENS:
+    return "consens";
+  case ConsensLib::EnumerationAlgorithm::SIMPLE:
+    return "simple";
+  case ConsensLib::EnumerationAlgorithm::ESU:
+    return "esu";
+  case ConsensLib::EnumerationAlgorithm::REVERSE_SEARCH:
+    return "reverse";
+  default:
+    return "auto";
+  }
+}
+
+// runs every algorithm on the graphs converted to 'BenchGraph', i.e. with the hooks of its traits
+template<typename BenchGraph>
+void benchmarkAlgorithms(const std::string& title, const std::vector<BenchmarkGraph>& graphs)
+{
+  const std::vector<std::pair<std::string, ConsensLib::EnumerationAlgorithm>> algorithms = {
+    {"consens", ConsensLib::EnumerationAlgorithm::CONSENS},
+    {"simple", ConsensLib::EnumerationAlgorithm::SIMPLE},
+    {"esu", ConsensLib::EnumerationAlgorithm::ESU},
+    {"reverse", ConsensLib::EnumerationAlgorithm::REVERSE_SEARCH},
+    {"auto", ConsensLib::EnumerationAlgorithm::AUTO}
+  };
+
+  std::cout << "--ALGORITHMS, " << title << "-- (milliseconds)\n\n" << std::left << std::setw(22) << "graph"
+            << std::setw(12) << "subgraphs";
+  for (const auto& algorithm : algorithms) {
+    std::cout << std::setw(12) << algorithm.first;
+  }
+  std::cout << std::setw(12) << "best" << "chosen\n";
+  for (const BenchmarkGraph& benchmarkGraph : graphs) {
+    BenchGraph graph(benchmarkGraph.graph);
+    CountingVisitor counter;
+    ConsensLib::runConsensVisitor(graph, counter, benchmarkGraph.upper);
+    std::cout << std::setw(22) << benchmarkGraph.name << std::setw(12) << counter.count;
+    std::string best;
+    double bestTime = 0.0;
+    for (const auto& algorithm : algorithms) {
+      double elapsed = measureMilliseconds([&]() {
+        CountingVisitor visitor;
+        ConsensLib::Intern::visitAlgorithmEnumeration<BenchGraph, uint32_t>(
+            graph, algorithm.second, benchmarkGraph.upper, ConsensLib::NoFilter(),
+            visitor, std::less<uint32_t>());
+      });
+      if (algorithm.second != ConsensLib::EnumerationAlgorithm::AUTO && (best.empty() || elapsed < bestTime)) {
+        best = algorithm.first;
+        bestTime = elapsed;
+      }
+      std::cout << std::setw(12) << std::fixed << std::setprecision(1) << elapsed;
+    }
+    std::cout << std::setw(12) << best
+              << getAlgorithmName(ConsensLib::selectEnumerationAlgorithm(graph, benchmarkGraph.upper)) << "\n";
+  }
+  std::cout << std::endl;
+}
+
+int main()
+{
+  std::vector<BenchmarkGraph> graphs = getBenchmarkGraphs();
+  benchmarkNodeOrders(graphs);
+  std::vector<BenchmarkGraph> algorithmGraphs = getAlgorithmGraphs();
+  benchmarkAlgorithms<Graph>("CSR GRAPH", algorithmGraphs);
+  benchmarkAlgorithms<AdjacencyGraph>("ADJACENCY LISTS WITHOUT HOOKS", algorithmGraphs);
+  return 0;
+}
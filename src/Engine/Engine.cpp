@@ -0,0 +1,89 @@
+#include "ConsensLib/Precompiled.hpp"
+
+#include "ConsensLib/Counting.hpp"
+#include "ConsensLib/Ordering.hpp"
+
+namespace ConsensLib {
+
+namespace Intern {
+
+template void visitEnumeration<CsrGraph<uint16_t>, uint16_t, NoFilter, std::less<uint16_t>,
+                               SubgraphCollector<uint16_t>>(
+    const CsrGraph<uint16_t>&, size_t, const NoFilter&, SubgraphCollector<uint16_t>&, const std::less<uint16_t>&);
+
+template void visitEnumeration<CsrGraph<uint32_t>, uint32_t, NoFilter, std::less<uint32_t>,
+                               SubgraphCollector<uint32_t>>(
+    const CsrGraph<uint32_t>&, size_t, const NoFilter&, SubgraphCollector<uint32_t>&, const std::less<uint32_t>&);
+
+template void visitEnumeration<CsrGraph<uint16_t>, uint16_t, NoFilter, std::less<uint16_t>,
+                               SubgraphCollector<uint16_t>>(
+    const CsrGraph<uint16_t>&, const std::vector<uint16_t>&, size_t, const NoFilter&, SubgraphCollector<uint16_t>&,
+    const std::less<uint16_t>&, std::true_type);
+
+template void visitEnumeration<CsrGraph<uint32_t>, uint32_t, NoFilter, std::less<uint32_t>,
+                               SubgraphCollector<uint32_t>>(
+    const CsrGraph<uint32_t>&, const std::vector<uint32_t>&, size_t, const NoFilter&, SubgraphCollector<uint32_t>&,
+    const std::less<uint32_t>&, std::true_type);
+
+template std::vector<std::vector<uint16_t>> runEnumeration<CsrGraph<uint16_t>, uint16_t, NoFilter,
+                                                           std::less<uint16_t>>(
+    const CsrGraph<uint16_t>&, size_t, const NoFilter&, const std::less<uint16_t>&);
+
+template std::vector<std::vector<uint32_t>> runEnumeration<CsrGraph<uint32_t>, uint32_t, NoFilter,
+                                                           std::less<uint32_t>>(
+    const CsrGraph<uint32_t>&, size_t, const NoFilter&, const std::less<uint32_t>&);
+
+} // end namespace Intern
+
+namespace Precompiled {
+
+std::vector<std::vector<uint16_t>> runConsens(
+    const CsrGraph<uint16_t>& graph,
+    size_t upper)
+{
+  return ConsensLib::runConsens(graph, upper);
+}
+
+std::vector<std::vector<uint32_t>> runConsens(
+    const CsrGraph<uint32_t>& graph,
+    size_t upper)
+{
+  return ConsensLib::runConsens(graph, upper);
+}
+
+std::vector<std::vector<uint16_t>> runConsensOrdered(
+    const CsrGraph<uint16_t>& graph,
+    NodeOrder order,
+    size_t upper,
+    unsigned seed)
+{
+  return ConsensLib::runConsensOrdered(graph, order, upper, NoFilter(), std::less<uint16_t>(), seed);
+}
+
+std::vector<std::vector<uint32_t>> runConsensOrdered(
+    const CsrGraph<uint32_t>& graph,
+    NodeOrder order,
+    size_t upper,
+    unsigned seed)
+{
+  return ConsensLib::runConsensOrdered(graph, order, upper, NoFilter(), std::less<uint32_t>(), seed);
+}
+
+std::vector<size_t> countConsens(
+    const CsrGraph<uint16_t>& graph,
+    size_t upper,
+    size_t maxWidth)
+{
+  return ConsensLib::countConsens(graph, upper, std::less<uint16_t>(), maxWidth);
+}
+
+std::vector<size_t> countConsens(
+    const CsrGraph<uint32_t>& graph,
+    size_t upper,
+    size_t maxWidth)
+{
+  return ConsensLib::countConsens(graph, upper, std::less<uint32_t>(), maxWidth);
+}
+
+} // end namespace Precompiled
+} // end namespace ConsensLib
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "ConsensLib/Consens.hpp"
+#include "ConsensLib/Maximal.hpp"
 
 class Graph {
 
@@ -145,6 +146,20 @@ int main()
     std::cout << "}\n";
   }
 
+  std::vector<std::vector<size_t>> maximalPaths = ConsensLib::runConsensMaximal(graph, filter);
+
+  std::cout << "\nNode sets of all maximal induced paths are\n\n";
+  for (const std::vector<size_t>& path : maximalPaths) {
+    std::cout << "{";
+    for (unsigned i = 0; i < path.size(); ++i) {
+      if (i != 0) {
+        std::cout << ", ";
+      }
+      std::cout << path.at(i);
+    }
+    std::cout << "}\n";
+  }
+
   return 0;
 }
 
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Algorithms.hpp"
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/CsrGraph.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+struct OddSumFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    return std::accumulate(subgraph.begin(), subgraph.end(), 0u) % 2 == 1;
+  }
+};
+
+std::vector<std::vector<unsigned>> getSorted(std::vector<std::vector<unsigned>> subgraphs)
+{
+  std::sort(subgraphs.begin(), subgraphs.end());
+  return subgraphs;
+}
+
+const std::vector<ConsensLib::EnumerationAlgorithm> ALGORITHMS = {
+  ConsensLib::EnumerationAlgorithm::AUTO,
+  ConsensLib::EnumerationAlgorithm::CONSENS,
+  ConsensLib::EnumerationAlgorithm::SIMPLE,
+  ConsensLib::EnumerationAlgorithm::ESU,
+  ConsensLib::EnumerationAlgorithm::REVERSE_SEARCH
+};
+
+/**
+ * Collects the emitted subgraphs and prunes every subgraph with 'limit' nodes.
+ */
+struct SizePruningVisitor : public ConsensLib::EnumerationVisitor
+{
+  SizePruningVisitor(size_t limit) : limit(limit) {}
+
+  void emit(const std::vector<unsigned>& subgraph)
+  {
+    subgraphs.push_back(subgraph);
+  }
+
+  bool expand(const std::vector<unsigned>& current, const std::vector<unsigned>& candidates)
+  {
+    return current.size() < limit;
+  }
+
+  size_t limit;
+  std::vector<std::vector<unsigned>> subgraphs;
+};
+
+class AlgorithmsTest : public ::testing::TestWithParam<GraphTestRow> {};
+
+TEST_P(AlgorithmsTest, TestAlgorithmsEqualConsens) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+  std::vector<std::vector<unsigned>> expected = getSorted(ConsensLib::runConsens(sorted, test_params.upperBound));
+  std::vector<std::vector<unsigned>> expectedFiltered
+      = getSorted(ConsensLib::runConsens(sorted, test_params.upperBound, OddSumFilter()));
+
+  for (ConsensLib::EnumerationAlgorithm algorithm : ALGORITHMS) {
+    std::vector<std::vector<unsigned>> result
+        = ConsensLib::runConsensAlgorithm(sorted, algorithm, test_params.upperBound);
+    checkValidity(result, sorted, test_params.upperBound);
+    EXPECT_EQ(getSorted(result), expected) << "algorithm " << static_cast<int>(algorithm);
+
+    std::vector<std::vector<unsigned>> filtered
+        = ConsensLib::runConsensAlgorithm(unsorted, algorithm, test_params.upperBound, OddSumFilter());
+    checkValidity(filtered, unsorted, test_params.upperBound, OddSumFilter());
+    EXPECT_EQ(getSorted(filtered), expectedFiltered) << "algorithm " << static_cast<int>(algorithm);
+
+    std::vector<std::vector<unsigned>> reversed = ConsensLib::runConsensAlgorithm(
+        unsorted, algorithm, test_params.upperBound, ConsensLib::NoFilter(), std::greater<unsigned>());
+    checkValidity(reversed, unsorted, test_params.upperBound, ConsensLib::NoFilter(), std::greater<unsigned>());
+    EXPECT_EQ(reversed.size(), expected.size()) << "algorithm " << static_cast<int>(algorithm);
+  }
+}
+
+TEST_P(AlgorithmsTest, TestConsensKeepsOrder) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  EXPECT_EQ(ConsensLib::runConsensAlgorithm(sorted, ConsensLib::EnumerationAlgorithm::CONSENS, test_params.upperBound),
+            ConsensLib::runConsens(sorted, test_params.upperBound));
+  EXPECT_NE(ConsensLib::selectEnumerationAlgorithm(sorted, test_params.upperBound),
+            ConsensLib::EnumerationAlgorithm::AUTO);
+}
+
+TEST_P(AlgorithmsTest, TestAlgorithmsAskVisitor) {
+
+  auto test_params = GetParam();
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+  std::vector<std::vector<unsigned>> expected
+      = getSorted(ConsensLib::runConsens(unsorted, std::min<size_t>(test_params.upperBound, 3)));
+
+  for (ConsensLib::EnumerationAlgorithm algorithm : ALGORITHMS) {
+    SizePruningVisitor visitor(3);
+    ConsensLib::runConsensAlgorithmVisitor(unsorted, visitor, algorithm, test_params.upperBound);
+    EXPECT_EQ(getSorted(visitor.subgraphs), expected) << "algorithm " << static_cast<int>(algorithm);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AlgorithmsTester, AlgorithmsTest, ::testing::ValuesIn(getGraphTestRows()));
+
+// a dense graph, where the automatic choice and the costs of the algorithms differ most
+INSTANTIATE_TEST_SUITE_P(DenseAlgorithmsTester, AlgorithmsTest, ::testing::Values(
+    GraphTestRow{getRandomEdges(24, 0.5, 6), 24, 4}
+));
+
+TEST(AlgorithmSelectionTest, TestSelectionFollowsBenchmark) {
+
+  // sparse with cycles and branching nodes: 40 edges on 25 nodes and degree four inside the grid
+  SortedTestGraph grid(25, getGridEdges(5, 5));
+  EXPECT_EQ(ConsensLib::selectEnumerationAlgorithm(grid, 6), ConsensLib::EnumerationAlgorithm::ESU);
+  EXPECT_EQ(ConsensLib::selectEnumerationAlgorithm(grid), ConsensLib::EnumerationAlgorithm::ESU);
+  EXPECT_EQ(ConsensLib::selectEnumerationAlgorithm(grid, 2), ConsensLib::EnumerationAlgorithm::SIMPLE);
+
+  // a cycle does not branch, a tree has no cycles and a dense graph has many edges per node
+  SortedTestGraph cycle(25, getCycleEdges(25));
+  EXPECT_EQ(ConsensLib::selectEnumerationAlgorithm(cycle, 6), ConsensLib::EnumerationAlgorithm::SIMPLE);
+  SortedTestGraph tree(25, getRandomTreeEdges(25, 1));
+  EXPECT_EQ(ConsensLib::selectEnumerationAlgorithm(tree, 6), ConsensLib::EnumerationAlgorithm::SIMPLE);
+  SortedTestGraph dense(24, getRandomEdges(24, 0.5, 6));
+  EXPECT_EQ(ConsensLib::selectEnumerationAlgorithm(dense, 6), ConsensLib::EnumerationAlgorithm::SIMPLE);
+
+  // the index hook of CsrGraph makes CONSENS the fastest on every graph
+  EdgeList gridEdges = getGridEdges(5, 5);
+  std::vector<std::pair<uint32_t, uint32_t>> csrEdges(gridEdges.begin(), gridEdges.end());
+  ConsensLib::CsrGraph<uint32_t> csrGrid(25, csrEdges);
+  EXPECT_EQ(ConsensLib::selectEnumerationAlgorithm(csrGrid, 6), ConsensLib::EnumerationAlgorithm::CONSENS);
+}
@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Cache.hpp"
+#include "ConsensLib/Consens.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+struct OddSumFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    return std::accumulate(subgraph.begin(), subgraph.end(), 0u) % 2 == 1;
+  }
+};
+
+EdgeList getPermutedEdges(const EdgeList& edges, unsigned nofNodes, unsigned seed)
+{
+  std::vector<unsigned> permutation(nofNodes);
+  std::iota(permutation.begin(), permutation.end(), 0u);
+  std::shuffle(permutation.begin(), permutation.end(), std::mt19937(seed));
+  EdgeList permuted;
+  for (const std::pair<unsigned, unsigned>& edge : edges) {
+    permuted.emplace_back(permutation.at(edge.first), permutation.at(edge.second));
+  }
+  return permuted;
+}
+
+std::vector<std::vector<unsigned>> getSorted(std::vector<std::vector<unsigned>> subgraphs)
+{
+  std::sort(subgraphs.begin(), subgraphs.end());
+  return subgraphs;
+}
+
+class CacheTest : public ::testing::TestWithParam<GraphTestRow> {};
+
+TEST_P(CacheTest, TestCachedEqualsEnumeration) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph permuted(test_params.nofNodes, getPermutedEdges(test_params.edges, test_params.nofNodes, 7));
+  ConsensLib::EnumerationCache cache;
+
+  std::vector<std::vector<unsigned>> result = ConsensLib::runConsensCached(sorted, cache, test_params.upperBound);
+  EXPECT_EQ(getSorted(result), getSorted(ConsensLib::runConsens(sorted, test_params.upperBound)));
+  checkValidity(result, sorted, test_params.upperBound);
+  EXPECT_EQ(cache.statistics().misses, 1u);
+  EXPECT_EQ(cache.statistics().hits, 0u);
+
+  // an isomorphic copy is answered from the cache
+  std::vector<std::vector<unsigned>> permutedResult
+      = ConsensLib::runConsensCached(permuted, cache, test_params.upperBound, OddSumFilter());
+  EXPECT_EQ(getSorted(permutedResult),
+            getSorted(ConsensLib::runConsens(permuted, test_params.upperBound, OddSumFilter())));
+  checkValidity(permutedResult, permuted, test_params.upperBound, OddSumFilter());
+  EXPECT_EQ(cache.statistics().misses, 1u);
+  EXPECT_EQ(cache.statistics().hits, 1u);
+  EXPECT_EQ(cache.statistics().entries, 1u);
+}
+
+INSTANTIATE_TEST_SUITE_P(CacheTester, CacheTest, ::testing::Values(
+    GraphTestRow{getPathEdges(8), 8, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getCycleEdges(9), 9, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getCycleEdges(12), 12, 5},
+    GraphTestRow{getCliqueEdges(8), 8, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getGridEdges(3, 4), 12, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getGridEdges(4, 4), 16, 6},
+    GraphTestRow{getRandomTreeEdges(15, 2), 15, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getRandomEdges(14, 0.3, 4), 14, std::numeric_limits<size_t>::max()},
+    GraphTestRow{EdgeList(), 5, std::numeric_limits<size_t>::max()},
+    GraphTestRow{EdgeList(), 0, std::numeric_limits<size_t>::max()}
+));
+
+TEST(CacheIdentityTest, TestNonIsomorphicGraphsAreDistinguished) {
+
+  ConsensLib::EnumerationCache cache;
+  // path and star with four nodes
+  SortedTestGraph path(4, getPathEdges(4));
+  SortedTestGraph star(4, EdgeList{{0, 1}, {0, 2}, {0, 3}});
+  // two triangles and a hexagon
+  SortedTestGraph triangles(6, EdgeList{{0, 1}, {1, 2}, {2, 0}, {3, 4}, {4, 5}, {5, 3}});
+  SortedTestGraph hexagon(6, getCycleEdges(6));
+  // the Petersen graph and the prism over a pentagon, both cubic with ten nodes
+  EdgeList petersenEdges{{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0},
+                         {0, 5}, {1, 6}, {2, 7}, {3, 8}, {4, 9},
+                         {5, 7}, {7, 9}, {9, 6}, {6, 8}, {8, 5}};
+  SortedTestGraph petersen(10, petersenEdges);
+  SortedTestGraph prism(10, EdgeList{{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0},
+                                     {0, 5}, {1, 6}, {2, 7}, {3, 8}, {4, 9},
+                                     {5, 6}, {6, 7}, {7, 8}, {8, 9}, {9, 5}});
+  for (const SortedTestGraph* graph : {&path, &star, &triangles, &hexagon, &petersen, &prism}) {
+    std::vector<std::vector<unsigned>> result = ConsensLib::runConsensCached(*graph, cache);
+    EXPECT_EQ(getSorted(result), getSorted(ConsensLib::runConsens(*graph)));
+  }
+  EXPECT_EQ(cache.statistics().misses, 6u);
+  EXPECT_EQ(cache.statistics().hits, 0u);
+
+  // different upper bounds are cached separately
+  ConsensLib::runConsensCached(petersen, cache, 3);
+  EXPECT_EQ(cache.statistics().misses, 7u);
+  UnsortedTestGraph shuffledPetersen(10, getPermutedEdges(petersenEdges, 10, 3));
+  ConsensLib::runConsensCached(shuffledPetersen, cache, 3);
+  ConsensLib::runConsensCached(shuffledPetersen, cache);
+  EXPECT_EQ(cache.statistics().hits, 2u);
+}
+
+TEST(CacheEvictionTest, TestLeastRecentlyUsedIsEvicted) {
+
+  SortedTestGraph small(6, getCycleEdges(6));
+  SortedTestGraph large(12, getGridEdges(3, 4));
+  ConsensLib::EnumerationCache probe;
+  ConsensLib::runConsensCached(small, probe);
+  size_t smallBytes = probe.statistics().bytes;
+  ConsensLib::runConsensCached(large, probe);
+  size_t largeBytes = probe.statistics().bytes - smallBytes;
+
+  // room for the large graph or the small one twice, but not for both
+  ConsensLib::EnumerationCache cache(std::max(largeBytes, 2 * smallBytes) + smallBytes - 1);
+  SortedTestGraph path(6, getPathEdges(6));
+  ConsensLib::runConsensCached(small, cache);
+  ConsensLib::runConsensCached(path, cache);
+  ConsensLib::runConsensCached(small, cache);
+  EXPECT_EQ(cache.statistics().hits, 1u);
+  EXPECT_EQ(cache.statistics().evictions, 0u);
+
+  // the path is least recently used and evicted first
+  ConsensLib::runConsensCached(large, cache);
+  EXPECT_GE(cache.statistics().evictions, 1u);
+  EXPECT_LE(cache.statistics().bytes, cache.maxBytes());
+  ConsensLib::runConsensCached(path, cache);
+  EXPECT_EQ(cache.statistics().hits, 1u);
+
+  // entries larger than the bound are not stored
+  ConsensLib::EnumerationCache tiny(16);
+  EXPECT_EQ(ConsensLib::runConsensCached(large, tiny).size(), ConsensLib::runConsens(large).size());
+  EXPECT_EQ(tiny.statistics().entries, 0u);
+  EXPECT_EQ(tiny.statistics().bytes, 0u);
+}
@@ -1,14 +1,166 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
 
 #include "ConsensLib/GraphTraits.hpp"
 #include "ConsensLib/Types.hpp"
+#include "ConsensLib/Intern/TraitHooks.hpp"
+
+/**
+ * Nodes of a graph numbered in the order of the compare function
+ * together with the adjacency lists of these numbers.
+ */
+template<typename Node>
+struct NumberedGraph {
+  std::vector<Node> nodes;
+  std::vector<std::vector<uint32_t>> adjacency;
+};
+
+/**
+ * Number of a node found by binary search in the sorted nodes, or the number of nodes if it is unknown.
+ * Nodes are identified by equivalence with respect to 'compare', so neither hashing nor 'operator==' is needed.
+ * Only used once per adjacency entry while numbering the graph.
+ */
+template<typename Node,
+         typename Compare>
+uint32_t getNumber(
+    const NumberedGraph<Node>& numbered,
+    const Node& node,
+    const Compare& compare)
+{
+  auto foundIter = std::lower_bound(numbered.nodes.begin(), numbered.nodes.end(), node, compare);
+  if (foundIter == numbered.nodes.end() || compare(node, *foundIter)) {
+    return static_cast<uint32_t>(numbered.nodes.size());
+  }
+  return static_cast<uint32_t>(foundIter - numbered.nodes.begin());
+}
 
+template<typename Graph,
+         typename Node,
+         typename Compare>
+NumberedGraph<Node> getNumberedGraph(
+    const Graph& graph,
+    const Compare& compare)
+{
+  NumberedGraph<Node> numbered;
+  numbered.nodes.assign(ConsensLib::GraphTraits<Graph>::nodesBegin(graph),
+                        ConsensLib::GraphTraits<Graph>::nodesEnd(graph));
+  std::sort(numbered.nodes.begin(), numbered.nodes.end(), compare);
+  numbered.adjacency.resize(numbered.nodes.size());
+  for (uint32_t number = 0; number < numbered.nodes.size(); ++number) {
+    const Node& node = numbered.nodes.at(number);
+    auto begin = ConsensLib::GraphTraits<Graph>::adjancencyBegin(node, graph);
+    auto end = ConsensLib::GraphTraits<Graph>::adjancencyEnd(node, graph);
+    for (auto iter = begin; iter != end; ++iter) {
+      numbered.adjacency.at(number).push_back(getNumber(numbered, *iter, compare));
+    }
+  }
+  return numbered;
+}
+
+/**
+ * Numbers the nodes of subgraphs sorted by 'compare' by walking them along the sorted nodes of the graph.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare,
+         bool hasIndex = ConsensLib::Intern::HasIndexHook<Graph>::value>
+class SubgraphNumbering
+{
+public:
+
+  SubgraphNumbering(
+      const Graph& graph,
+      const NumberedGraph<Node>& numbered,
+      const Compare& compare)
+    : m_numbered(numbered),
+      m_compare(compare) {}
+
+  /**
+   * Append the numbers of the nodes of a sorted subgraph and return false if a node is unknown.
+   */
+  bool operator()(
+      const std::vector<Node>& subgraph,
+      std::vector<uint32_t>& numbers) const
+  {
+    const std::vector<Node>& nodes = m_numbered.nodes;
+    size_t number = 0;
+    for (const Node& node : subgraph) {
+      while (number < nodes.size() && m_compare(nodes[number], node)) {
+        ++number;
+      }
+      if (number == nodes.size() || m_compare(node, nodes[number])) {
+        return false;
+      }
+      numbers.push_back(static_cast<uint32_t>(number));
+    }
+    return true;
+  }
+
+private:
+
+  const NumberedGraph<Node>& m_numbered;
+  const Compare& m_compare;
+};
+
+/**
+ * Numbers the nodes of subgraphs by an array lookup with the 'index' hook of the traits.
+ */
+template<typename Graph,
+         typename Node,
+         typename Compare>
+class SubgraphNumbering<Graph, Node, Compare, true>
+{
+public:
+
+  SubgraphNumbering(
+      const Graph& graph,
+      const NumberedGraph<Node>& numbered,
+      const Compare& compare)
+    : m_graph(graph),
+      m_numbers(ConsensLib::GraphTraits<Graph>::nodeCount(graph), static_cast<uint32_t>(numbered.nodes.size()))
+  {
+    for (size_t number = 0; number < numbered.nodes.size(); ++number) {
+      m_numbers[ConsensLib::GraphTraits<Graph>::index(numbered.nodes[number], graph)] = static_cast<uint32_t>(number);
+    }
+    m_unknown = static_cast<uint32_t>(numbered.nodes.size());
+  }
+
+  bool operator()(
+      const std::vector<Node>& subgraph,
+      std::vector<uint32_t>& numbers) const
+  {
+    for (const Node& node : subgraph) {
+      size_t idx = ConsensLib::GraphTraits<Graph>::index(node, m_graph);
+      if (idx >= m_numbers.size() || m_numbers[idx] == m_unknown) {
+        return false;
+      }
+      numbers.push_back(m_numbers[idx]);
+    }
+    return true;
+  }
+
+private:
+
+  const Graph& m_graph;
+  std::vector<uint32_t> m_numbers;
+  uint32_t m_unknown = 0;
+};
+
+/**
+ * Check that all subgraphs respect the upper bound and the filter, are sorted, connected and unique.
+ * Every sorted subgraph is numbered with the 'index' hook of the traits if present, otherwise by
+ * walking it along the sorted nodes of the graph, so no node is searched. Runs in time linear in the
+ * total size of the subgraphs, plus the number of nodes per subgraph without the hook, and sorting
+ * their hash values, so it is usable for millions of subgraphs.
+ */
 template<typename Graph,
          typename Node = typename ConsensLib::GraphTraits<Graph>::Node,
          typename FilterFunc = ConsensLib::NoFilter,
@@ -20,47 +172,173 @@ void checkValidity(
     const FilterFunc& filter = FilterFunc(),
     const Compare& compare = Compare())
 {
-  for (unsigned i = 0; i < subgraphs.size(); ++i) {
-    const std::vector<Node>& subgraph = subgraphs.at(i);
+  NumberedGraph<Node> numbered = getNumberedGraph<Graph, Node>(graph, compare);
+  SubgraphNumbering<Graph, Node, Compare> numbering(graph, numbered, compare);
+
+  size_t nofTooLarge = 0;
+  size_t nofFiltered = 0;
+  size_t nofUnsorted = 0;
+  size_t nofUnknown = 0;
+  size_t nofDisconnected = 0;
+
+  std::vector<size_t> stamps(numbered.nodes.size(), 0);
+  std::vector<uint32_t> numbers;
+  std::vector<uint32_t> queue;
+  std::vector<std::pair<uint64_t, size_t>> hashes;
+  hashes.reserve(subgraphs.size());
+
+  for (size_t i = 0; i < subgraphs.size(); ++i) {
+    const std::vector<Node>& subgraph = subgraphs[i];
+    size_t stamp = i + 1;
     // check size
-    EXPECT_LE(subgraph.size(), upper);
+    nofTooLarge += subgraph.size() > upper;
 
     // check filter criteria
-    EXPECT_TRUE(filter(subgraph));
-
-    // check connectivity
-    if (subgraph.size() > 1) {
-      for (const Node& node : subgraph) {
-        auto begin = ConsensLib::GraphTraits<Graph>::adjancencyBegin(node, graph);
-        auto end = ConsensLib::GraphTraits<Graph>::adjancencyEnd(node, graph);
-        bool hasNeighbor = false;
-        for (auto iter = begin; iter != end; ++iter) {
-          auto foundIter = std::lower_bound(subgraph.begin(), subgraph.end(), *iter, compare);
-          // !compare(*foundIter, *iter) already checked by lower_bound
-          if (foundIter != subgraph.end() && !compare(*iter, *foundIter)) {
-            hasNeighbor = true;
-            break;
-          }
+    nofFiltered += !filter(subgraph);
+
+    // check order, which the numbering relies on
+    if (std::adjacent_find(subgraph.begin(), subgraph.end(), [&compare](const Node& n1, const Node& n2) {
+          return !compare(n1, n2);
+        }) != subgraph.end()) {
+      ++nofUnsorted;
+      continue;
+    }
+
+    numbers.clear();
+    if (subgraph.empty() || !numbering(subgraph, numbers)) {
+      ++nofUnknown;
+      continue;
+    }
+    uint64_t hash = 14695981039346656037ull;
+    for (uint32_t number : numbers) {
+      stamps[number] = stamp;
+      hash = (hash ^ number) * 1099511628211ull;
+    }
+    hashes.emplace_back(hash, i);
+
+    // check connectivity with a breadth-first search within the subgraph
+    queue.assign(1, numbers.front());
+    stamps[numbers.front()] = 0;
+    for (size_t head = 0; head < queue.size(); ++head) {
+      for (uint32_t neighbor : numbered.adjacency[queue[head]]) {
+        if (stamps[neighbor] == stamp) {
+          stamps[neighbor] = 0;
+          queue.push_back(neighbor);
         }
-        EXPECT_TRUE(hasNeighbor);
       }
     }
+    nofDisconnected += queue.size() != subgraph.size();
+  }
+
+  EXPECT_EQ(nofTooLarge, 0u) << "subgraphs exceed the upper bound";
+  EXPECT_EQ(nofFiltered, 0u) << "subgraphs violate the filter";
+  EXPECT_EQ(nofUnsorted, 0u) << "subgraphs are not sorted";
+  EXPECT_EQ(nofUnknown, 0u) << "subgraphs are empty or contain unknown nodes";
+  EXPECT_EQ(nofDisconnected, 0u) << "subgraphs are not connected";
 
-    // check uniqueness
-    for (unsigned j = i + 1; j < subgraphs.size(); ++j) {
-      const std::vector<Node>& other = subgraphs.at(j);
-      bool same = subgraph.size() == other.size();
+  // check uniqueness by comparing subgraphs with equal hash values only
+  std::sort(hashes.begin(), hashes.end());
+  size_t nofDuplicates = 0;
+  for (size_t i = 1; i < hashes.size(); ++i) {
+    for (size_t j = i; j > 0 && hashes[j - 1].first == hashes[i].first; --j) {
+      const std::vector<Node>& subgraph = subgraphs[hashes[i].second];
+      const std::vector<Node>& other = subgraphs[hashes[j - 1].second];
+      bool same = subgraph.size() == other.size()
+          && std::equal(subgraph.begin(), subgraph.end(), other.begin(), [&compare](const Node& n1, const Node& n2) {
+               return !compare(n1, n2) && !compare(n2, n1);
+             });
       if (same) {
-        for (unsigned idx = 0; idx < subgraph.size(); ++idx) {
-          const Node& n1 = subgraph.at(idx);
-          const Node& n2 = other.at(idx);
-          if (compare(n1, n2) || compare(n2, n1)) {
-            same = false;
-            break;
-          }
+        ++nofDuplicates;
+        break;
+      }
+    }
+  }
+  EXPECT_EQ(nofDuplicates, 0u) << "subgraphs are not unique";
+}
+
+/**
+ * Count the connected induced subgraphs fulfilling the filter criteria by testing all subsets of nodes.
+ * Independent of the enumeration and only feasible for at most 25 nodes.
+ */
+template<typename Graph,
+         typename Node = typename ConsensLib::GraphTraits<Graph>::Node,
+         typename FilterFunc = ConsensLib::NoFilter,
+         typename Compare = std::less<Node>>
+size_t countConnectedSubsets(
+    const Graph& graph,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare())
+{
+  NumberedGraph<Node> numbered = getNumberedGraph<Graph, Node>(graph, compare);
+  size_t nofNodes = numbered.nodes.size();
+  if (nofNodes > 25) {
+    ADD_FAILURE() << "brute force counting is limited to 25 nodes";
+    return 0;
+  }
+  std::vector<uint32_t> neighborMasks(nofNodes, 0);
+  for (size_t number = 0; number < nofNodes; ++number) {
+    for (uint32_t neighbor : numbered.adjacency[number]) {
+      neighborMasks[number] |= uint32_t(1) << neighbor;
+    }
+  }
+  size_t count = 0;
+  std::vector<Node> subgraph;
+  for (uint32_t mask = 1; mask < (uint32_t(1) << nofNodes); ++mask) {
+    size_t size = 0;
+    for (uint32_t bits = mask; bits != 0; bits &= bits - 1) {
+      ++size;
+    }
+    if (size > upper) {
+      continue;
+    }
+    uint32_t reached = mask & (~mask + 1);
+    uint32_t frontier = reached;
+    while (frontier != 0) {
+      uint32_t next = 0;
+      for (uint32_t bits = frontier; bits != 0; bits &= bits - 1) {
+        unsigned number = 0;
+        while (((bits >> number) & 1) == 0) {
+          ++number;
+        }
+        next |= neighborMasks[number];
+      }
+      frontier = next & mask & ~reached;
+      reached |= frontier;
+    }
+    if (reached != mask) {
+      continue;
+    }
+    if (!std::is_same<FilterFunc, ConsensLib::NoFilter>::value) {
+      subgraph.clear();
+      for (size_t number = 0; number < nofNodes; ++number) {
+        if ((mask >> number) & 1) {
+          subgraph.push_back(numbered.nodes[number]);
         }
       }
-      EXPECT_FALSE(same);
+      if (!filter(subgraph)) {
+        continue;
+      }
     }
+    ++count;
   }
+  return count;
+}
+
+/**
+ * Check that the subgraphs contain every connected induced subgraph fulfilling the filter criteria.
+ * Together with \ref checkValidity this verifies that exactly the expected node sets were generated.
+ */
+template<typename Graph,
+         typename Node = typename ConsensLib::GraphTraits<Graph>::Node,
+         typename FilterFunc = ConsensLib::NoFilter,
+         typename Compare = std::less<Node>>
+void checkCompleteness(
+    const std::vector<std::vector<Node>>& subgraphs,
+    const Graph& graph,
+    size_t upper = std::numeric_limits<size_t>::max(),
+    const FilterFunc& filter = FilterFunc(),
+    const Compare& compare = Compare())
+{
+  EXPECT_EQ(subgraphs.size(), countConnectedSubsets(graph, upper, filter, compare));
 }
@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/Counting.hpp"
+
+#include "TestGraphs.hpp"
+
+class CountingTest : public ::testing::TestWithParam<GraphTestRow> {};
+
+std::vector<size_t> getSizeHistogram(const std::vector<std::vector<unsigned>>& subgraphs, size_t length)
+{
+  std::vector<size_t> histogram(length, 0);
+  for (const std::vector<unsigned>& subgraph : subgraphs) {
+    ++histogram.at(subgraph.size());
+  }
+  return histogram;
+}
+
+TEST_P(CountingTest, TestCountEqualsEnumeration) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+
+  size_t length = std::min<size_t>(test_params.upperBound, test_params.nofNodes) + 1;
+  std::vector<size_t> expected
+      = getSizeHistogram(ConsensLib::runConsens(sorted, test_params.upperBound), length);
+
+  // dynamic programming over the decomposition
+  EXPECT_EQ(ConsensLib::countConsens(sorted, test_params.upperBound), expected);
+  EXPECT_EQ(ConsensLib::countConsens(unsorted, test_params.upperBound), expected);
+  EXPECT_EQ(ConsensLib::countConsens(sorted, test_params.upperBound, std::less<unsigned>(), 14), expected);
+
+  // fallback to the enumeration
+  EXPECT_EQ(ConsensLib::countConsens(sorted, test_params.upperBound, std::less<unsigned>(), 0), expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(CountingTester, CountingTest, ::testing::Values(
+    GraphTestRow{getPathEdges(9), 9, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getPathEdges(9), 9, 4},
+    GraphTestRow{getCycleEdges(10), 10, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getCycleEdges(10), 10, 0},
+    GraphTestRow{getCliqueEdges(7), 7, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getCliqueEdges(7), 7, 3},
+    GraphTestRow{getGridEdges(3, 5), 15, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getGridEdges(4, 4), 16, 6},
+    GraphTestRow{getRandomTreeEdges(40, 5), 40, 7},
+    GraphTestRow{getRandomTreeEdges(18, 9), 18, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getRandomEdges(16, 0.2, 13), 16, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getRandomEdges(14, 0.5, 17), 14, 5},
+    GraphTestRow{EdgeList(), 4, std::numeric_limits<size_t>::max()},
+    GraphTestRow{EdgeList(), 0, std::numeric_limits<size_t>::max()}
+));
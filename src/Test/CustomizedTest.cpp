@@ -267,6 +267,9 @@ TEST_P(CustomizedGraphTest, TestCustomConsens) {
 
   checkValidity(resultLessSorted, *sorted_graph, test_params.upperBound, lessFilter, compare);
   checkValidity(resultBiggerSorted, *sorted_graph, test_params.upperBound, biggerFilter, compare);
+
+  checkCompleteness(resultLessSorted, *sorted_graph, test_params.upperBound, lessFilter, compare);
+  checkCompleteness(resultBiggerSorted, *sorted_graph, test_params.upperBound, biggerFilter, compare);
 }
 
 INSTANTIATE_TEST_SUITE_P(CustomizedTester, CustomizedGraphTest, ::testing::Values(
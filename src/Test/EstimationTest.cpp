@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/Estimation.hpp"
+
+#include "TestGraphs.hpp"
+
+struct EstimationTestRow {
+  EdgeList edges;
+  unsigned nofNodes;
+  size_t upperBound;
+  size_t nofProbes;
+};
+
+class EstimationTest : public ::testing::TestWithParam<EstimationTestRow> {};
+
+TEST_P(EstimationTest, TestEstimateMatchesEnumeration) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+
+  std::vector<std::vector<unsigned>> subgraphs = ConsensLib::runConsens(sorted, test_params.upperBound);
+  size_t length = std::min<size_t>(test_params.upperBound, test_params.nofNodes) + 1;
+  std::vector<double> expected(length, 0);
+  std::vector<double> expectedRoots(test_params.nofNodes, 0);
+  for (const std::vector<unsigned>& subgraph : subgraphs) {
+    ++expected.at(subgraph.size());
+    ++expectedRoots.at(subgraph.front());
+  }
+
+  ConsensLib::EnumerationEstimate<unsigned> estimate
+      = ConsensLib::estimateConsens(sorted, test_params.upperBound, test_params.nofProbes);
+  ASSERT_EQ(estimate.counts.size(), length);
+  ASSERT_EQ(estimate.rootCounts.size(), test_params.nofNodes);
+  if (length > 1) {
+    EXPECT_DOUBLE_EQ(estimate.counts.at(1), test_params.nofNodes);
+  }
+  for (size_t size = 0; size < length; ++size) {
+    EXPECT_LE(estimate.lowerCounts.at(size), estimate.counts.at(size));
+    EXPECT_GE(estimate.upperCounts.at(size), estimate.counts.at(size));
+  }
+  EXPECT_LE(estimate.lowerTotal, static_cast<double>(subgraphs.size()));
+  EXPECT_GE(estimate.upperTotal, static_cast<double>(subgraphs.size()));
+  EXPECT_NEAR(estimate.total, subgraphs.size(), 0.15 * subgraphs.size());
+  double total = std::accumulate(estimate.counts.begin(), estimate.counts.end(), 0.0);
+  EXPECT_NEAR(estimate.total, total, 1e-6 * total);
+  double rootTotal = std::accumulate(estimate.rootCounts.begin(), estimate.rootCounts.end(), 0.0);
+  EXPECT_NEAR(rootTotal, subgraphs.size(), 0.15 * subgraphs.size());
+  for (unsigned root = 0; root < test_params.nofNodes; ++root) {
+    EXPECT_NEAR(estimate.rootCounts.at(root), expectedRoots.at(root), 0.5 * expectedRoots.at(root) + 1);
+  }
+
+  // the probes do not depend on the order of the adjacency lists
+  ConsensLib::EnumerationEstimate<unsigned> unsortedEstimate
+      = ConsensLib::estimateConsens(unsorted, test_params.upperBound, test_params.nofProbes);
+  EXPECT_EQ(unsortedEstimate.counts, estimate.counts);
+}
+
+TEST(EstimationEdgeCaseTest, TestEmptyEstimates) {
+
+  SortedTestGraph graph(5, getPathEdges(5));
+  ConsensLib::EnumerationEstimate<unsigned> estimate = ConsensLib::estimateConsens(graph, 0);
+  EXPECT_EQ(estimate.counts, std::vector<double>(1, 0));
+  EXPECT_EQ(estimate.total, 0);
+
+  estimate = ConsensLib::estimateConsens(graph, std::numeric_limits<size_t>::max(), 0);
+  EXPECT_EQ(estimate.nofProbes, 0u);
+  EXPECT_EQ(estimate.total, 0);
+
+  SortedTestGraph empty(0, EdgeList());
+  estimate = ConsensLib::estimateConsens(empty);
+  EXPECT_EQ(estimate.counts, std::vector<double>(1, 0));
+  EXPECT_TRUE(estimate.roots.empty());
+}
+
+INSTANTIATE_TEST_SUITE_P(EstimationTester, EstimationTest, ::testing::Values(
+    EstimationTestRow{getPathEdges(10), 10, std::numeric_limits<size_t>::max(), 2000},
+    EstimationTestRow{getCycleEdges(12), 12, 5, 2000},
+    EstimationTestRow{getGridEdges(4, 4), 16, std::numeric_limits<size_t>::max(), 20000},
+    EstimationTestRow{getRandomTreeEdges(30, 3), 30, 8, 20000},
+    EstimationTestRow{getRandomEdges(16, 0.3, 9), 16, std::numeric_limits<size_t>::max(), 20000},
+    EstimationTestRow{getCliqueEdges(10), 10, std::numeric_limits<size_t>::max(), 5000}
+));
@@ -0,0 +1,114 @@
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/EventStream.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+struct IncrementalSumVisitor : public ConsensLib::EnumerationVisitor {
+  void push(unsigned node)
+  {
+    sum += node;
+    ++depth;
+  }
+
+  void pop(unsigned node)
+  {
+    sum -= node;
+    --depth;
+  }
+
+  void emit(const std::vector<unsigned>& subgraph)
+  {
+    EXPECT_EQ(subgraph.size(), depth);
+    sums.push_back(sum);
+  }
+
+  size_t sum = 0;
+  size_t depth = 0;
+  std::vector<size_t> sums;
+};
+
+struct EvenSizeFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    return subgraph.size() % 2 == 0;
+  }
+};
+
+class EventStreamTest : public ::testing::TestWithParam<GraphTestRow> {};
+
+TEST_P(EventStreamTest, TestIncrementalState) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+
+  std::vector<std::vector<unsigned>> expected = ConsensLib::runConsens(sorted, test_params.upperBound);
+
+  IncrementalSumVisitor sortedVisitor;
+  ConsensLib::runConsensVisitor(sorted, sortedVisitor, test_params.upperBound);
+  IncrementalSumVisitor unsortedVisitor;
+  ConsensLib::runConsensVisitor(unsorted, unsortedVisitor, test_params.upperBound);
+
+  ASSERT_EQ(sortedVisitor.sums.size(), expected.size());
+  for (unsigned i = 0; i < expected.size(); ++i) {
+    size_t sum = 0;
+    for (unsigned node : expected.at(i)) {
+      sum += node;
+    }
+    EXPECT_EQ(sortedVisitor.sums.at(i), sum);
+  }
+  EXPECT_EQ(sortedVisitor.sums, unsortedVisitor.sums);
+  EXPECT_EQ(sortedVisitor.depth, 0u);
+}
+
+TEST_P(EventStreamTest, TestEncodeDecode) {
+
+  auto test_params = GetParam();
+  SortedTestGraph graph(test_params.nofNodes, test_params.edges);
+
+  for (bool filtered : {false, true}) {
+    std::vector<std::vector<unsigned>> expected = filtered
+        ? ConsensLib::runConsens(graph, test_params.upperBound, EvenSizeFilter())
+        : ConsensLib::runConsens(graph, test_params.upperBound);
+
+    ConsensLib::EventStreamEncoder<unsigned> encoder;
+    if (filtered) {
+      ConsensLib::runConsensVisitor(graph, encoder, test_params.upperBound, EvenSizeFilter());
+    }
+    else {
+      ConsensLib::runConsensVisitor(graph, encoder, test_params.upperBound);
+    }
+    const std::vector<unsigned char>& data = encoder.finish();
+
+    ConsensLib::Intern::SubgraphCollector<unsigned> collector;
+    EXPECT_TRUE(ConsensLib::decodeEventStream<unsigned>(data.data(), data.data() + data.size(), collector));
+    EXPECT_EQ(collector.subgraphs, expected);
+
+    // one push and one pop per search tree node take at most four bytes for small node indices
+    EXPECT_LE(data.size(), 4 * std::max<size_t>(expected.size(), 1));
+  }
+}
+
+TEST(EventStreamTest, TestMalformedStream) {
+  ConsensLib::Intern::SubgraphCollector<unsigned> collector;
+  std::vector<unsigned char> truncated({0x80});
+  EXPECT_FALSE(ConsensLib::decodeEventStream<unsigned>(truncated.data(), truncated.data() + truncated.size(), collector));
+  // pop without a preceding push
+  std::vector<unsigned char> pop({0x06});
+  EXPECT_FALSE(ConsensLib::decodeEventStream<unsigned>(pop.data(), pop.data() + pop.size(), collector));
+}
+
+INSTANTIATE_TEST_SUITE_P(EventStreamTester, EventStreamTest, ::testing::Values(
+    GraphTestRow{getPathEdges(6), 6, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getCycleEdges(7), 7, 4},
+    GraphTestRow{getCliqueEdges(6), 6, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getGridEdges(3, 4), 12, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getRandomEdges(14, 0.3, 7), 14, 6},
+    GraphTestRow{EdgeList(), 0, std::numeric_limits<size_t>::max()}
+));
@@ -0,0 +1,46 @@
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/Ordering.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+struct LargeGraphTestRow {
+  EdgeList edges;
+  unsigned nofNodes;
+  size_t upperBound;
+  size_t minResults;
+};
+
+class LargeGraphTest : public ::testing::TestWithParam<LargeGraphTestRow> {};
+
+TEST_P(LargeGraphTest, TestDifferentialEnumeration) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+
+  std::vector<std::vector<unsigned>> result = ConsensLib::runConsens(sorted, test_params.upperBound);
+  EXPECT_GE(result.size(), test_params.minResults);
+  checkValidity(result, sorted, test_params.upperBound);
+  checkCompleteness(result, sorted, test_params.upperBound);
+
+  EXPECT_EQ(ConsensLib::runConsens(unsorted, test_params.upperBound), result);
+
+  std::vector<std::vector<unsigned>> ordered
+      = ConsensLib::runConsensOrdered(sorted, ConsensLib::NodeOrder::DEGREE_DESCENDING, test_params.upperBound);
+  checkValidity(ordered, sorted, test_params.upperBound);
+  EXPECT_EQ(ordered.size(), result.size());
+}
+
+INSTANTIATE_TEST_SUITE_P(LargeGraphTester, LargeGraphTest, ::testing::Values(
+    LargeGraphTestRow{getGridEdges(4, 5), 20, std::numeric_limits<size_t>::max(), 100000},
+    LargeGraphTestRow{getRandomEdges(21, 0.3, 5), 21, std::numeric_limits<size_t>::max(), 1000000},
+    LargeGraphTestRow{getRandomEdges(22, 0.2, 8), 22, 9, 50000},
+    LargeGraphTestRow{getCliqueEdges(20), 20, 10, 500000}
+));
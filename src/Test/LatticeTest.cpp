@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/Lattice.hpp"
+
+#include "TestGraphs.hpp"
+
+using LatticeEdges = std::vector<std::pair<size_t, size_t>>;
+
+/**
+ * Get the edges of the lattice by looking up every subgraph with one node removed.
+ */
+LatticeEdges getExpectedEdges(const std::vector<std::vector<unsigned>>& subgraphs)
+{
+  std::map<std::vector<unsigned>, size_t> ids;
+  for (size_t id = 0; id < subgraphs.size(); ++id) {
+    ids[subgraphs[id]] = id;
+  }
+  LatticeEdges edges;
+  for (size_t id = 0; id < subgraphs.size(); ++id) {
+    for (size_t pos = 0; subgraphs[id].size() > 1 && pos < subgraphs[id].size(); ++pos) {
+      std::vector<unsigned> parent = subgraphs[id];
+      parent.erase(parent.begin() + pos);
+      auto foundIter = ids.find(parent);
+      if (foundIter != ids.end()) {
+        edges.emplace_back(foundIter->second, id);
+      }
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+  return edges;
+}
+
+LatticeEdges getSorted(LatticeEdges edges)
+{
+  std::sort(edges.begin(), edges.end());
+  return edges;
+}
+
+struct EventRecorder : public ConsensLib::LatticeVisitor
+{
+  void node(size_t id, const std::vector<unsigned>& subgraph)
+  {
+    EXPECT_EQ(id, nofNodes);
+    ++nofNodes;
+  }
+
+  void edge(size_t parent, size_t child)
+  {
+    EXPECT_LT(parent, nofNodes);
+    EXPECT_LT(child, nofNodes);
+    EXPECT_TRUE(parent == nofNodes - 1 || child == nofNodes - 1);
+    ++nofEdges;
+  }
+
+  size_t nofNodes = 0;
+  size_t nofEdges = 0;
+};
+
+class LatticeTest : public ::testing::TestWithParam<GraphTestRow> {};
+
+TEST_P(LatticeTest, TestLatticeEqualsBruteForce) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+
+  ConsensLib::SubgraphLattice<unsigned> lattice = ConsensLib::runConsensLattice(sorted, test_params.upperBound);
+  EXPECT_EQ(lattice.subgraphs, ConsensLib::runConsens(sorted, test_params.upperBound));
+  EXPECT_EQ(getSorted(lattice.edges), getExpectedEdges(lattice.subgraphs));
+
+  ConsensLib::SubgraphLattice<unsigned> reversed
+      = ConsensLib::runConsensLattice(unsorted, test_params.upperBound, std::greater<unsigned>());
+  EXPECT_EQ(reversed.subgraphs, ConsensLib::runConsens(unsorted, test_params.upperBound,
+                                                       ConsensLib::NoFilter(), std::greater<unsigned>()));
+  EXPECT_EQ(getSorted(reversed.edges), getExpectedEdges(reversed.subgraphs));
+}
+
+TEST_P(LatticeTest, TestEdgesFollowLaterSubgraph) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  EventRecorder recorder;
+  ConsensLib::runConsensLatticeVisitor(sorted, recorder, test_params.upperBound);
+  ConsensLib::SubgraphLattice<unsigned> lattice = ConsensLib::runConsensLattice(sorted, test_params.upperBound);
+  EXPECT_EQ(recorder.nofNodes, lattice.subgraphs.size());
+  EXPECT_EQ(recorder.nofEdges, lattice.edges.size());
+}
+
+INSTANTIATE_TEST_SUITE_P(LatticeTester, LatticeTest, ::testing::ValuesIn(getGraphTestRows()));
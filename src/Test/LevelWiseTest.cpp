@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/LevelWise.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+struct OddSumFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    return std::accumulate(subgraph.begin(), subgraph.end(), 0u) % 2 == 1;
+  }
+};
+
+std::vector<std::vector<unsigned>> getSorted(std::vector<std::vector<unsigned>> subgraphs)
+{
+  std::sort(subgraphs.begin(), subgraphs.end());
+  return subgraphs;
+}
+
+struct LevelRecorder : public ConsensLib::LevelVisitor
+{
+  void emit(const std::vector<unsigned>& subgraph)
+  {
+    events.push_back(subgraph.size());
+  }
+
+  void levelFinished(size_t size)
+  {
+    events.push_back(0);
+    finished.push_back(size);
+  }
+
+  std::vector<size_t> events;
+  std::vector<size_t> finished;
+};
+
+class LevelWiseTest : public ::testing::TestWithParam<GraphTestRow> {};
+
+TEST_P(LevelWiseTest, TestLevelWiseEqualsConsens) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+  std::vector<std::vector<unsigned>> expected = getSorted(ConsensLib::runConsens(sorted, test_params.upperBound));
+
+  std::vector<std::vector<unsigned>> result = ConsensLib::runConsensLevelWise(sorted, test_params.upperBound);
+  checkValidity(result, sorted, test_params.upperBound);
+  EXPECT_EQ(getSorted(result), expected);
+  EXPECT_TRUE(std::is_sorted(result.begin(), result.end(),
+      [](const std::vector<unsigned>& a, const std::vector<unsigned>& b) { return a.size() < b.size(); }));
+
+  std::vector<std::vector<unsigned>> filtered
+      = ConsensLib::runConsensLevelWise(unsorted, test_params.upperBound, OddSumFilter());
+  checkValidity(filtered, unsorted, test_params.upperBound, OddSumFilter());
+  EXPECT_EQ(getSorted(filtered), getSorted(ConsensLib::runConsens(sorted, test_params.upperBound, OddSumFilter())));
+
+  std::vector<std::vector<unsigned>> reversed = ConsensLib::runConsensLevelWise(
+      unsorted, test_params.upperBound, ConsensLib::NoFilter(), std::greater<unsigned>());
+  checkValidity(reversed, unsorted, test_params.upperBound, ConsensLib::NoFilter(), std::greater<unsigned>());
+  EXPECT_EQ(reversed.size(), expected.size());
+}
+
+TEST_P(LevelWiseTest, TestSpilledFrontierKeepsOrder) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  std::vector<std::vector<unsigned>> inMemory = ConsensLib::runConsensLevelWise(sorted, test_params.upperBound);
+  bool complete = false;
+  std::vector<std::vector<unsigned>> spilled = ConsensLib::runConsensLevelWise(
+      sorted, test_params.upperBound, ConsensLib::NoFilter(), std::less<unsigned>(), 64, &complete);
+  EXPECT_TRUE(complete);
+  EXPECT_EQ(spilled, inMemory);
+}
+
+TEST_P(LevelWiseTest, TestLevelsFinishAfterTheirSubgraphs) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  LevelRecorder recorder;
+  EXPECT_TRUE(ConsensLib::runConsensLevelWiseVisitor(sorted, recorder, test_params.upperBound));
+
+  size_t level = 1;
+  for (size_t event : recorder.events) {
+    if (event == 0) {
+      ++level;
+    } else {
+      EXPECT_EQ(event, level);
+    }
+  }
+  std::vector<size_t> expectedFinished;
+  if (test_params.upperBound != 0 && test_params.nofNodes != 0) {
+    size_t largest = 0;
+    for (const std::vector<unsigned>& subgraph : ConsensLib::runConsens(sorted, test_params.upperBound)) {
+      largest = std::max(largest, subgraph.size());
+    }
+    expectedFinished.resize(largest);
+    std::iota(expectedFinished.begin(), expectedFinished.end(), 1);
+  }
+  EXPECT_EQ(recorder.finished, expectedFinished);
+}
+
+INSTANTIATE_TEST_SUITE_P(LevelWiseTester, LevelWiseTest, ::testing::ValuesIn(getGraphTestRows()));
+
+TEST(SpillingFrontierTest, TestRecordsReadBackInOrder) {
+
+  ConsensLib::Intern::SpillingFrontier frontier(3, 40);
+  for (uint32_t record = 0; record < 100; ++record) {
+    uint32_t entries[3] = {record, record + 1, record + 2};
+    frontier.append(entries);
+  }
+  EXPECT_EQ(frontier.nofRecords(), 100u);
+  EXPECT_TRUE(frontier.spilled());
+
+  std::vector<uint32_t> firsts;
+  frontier.forEach([&](const uint32_t* record) {
+    EXPECT_EQ(record[1], record[0] + 1);
+    EXPECT_EQ(record[2], record[0] + 2);
+    firsts.push_back(record[0]);
+  });
+  std::vector<uint32_t> expected(100);
+  std::iota(expected.begin(), expected.end(), 0);
+  EXPECT_EQ(firsts, expected);
+}
+
+TEST(SpillingFrontierTest, TestFailedWriteIsReported) {
+
+  // every write to /dev/full fails with ENOSPC
+  std::FILE* file = std::fopen("/dev/full", "w+");
+  if (file == nullptr) {
+    return;
+  }
+  ConsensLib::Intern::SpillingFrontier frontier(3, 40, file);
+  for (uint32_t record = 0; record < 100; ++record) {
+    uint32_t entries[3] = {record, record + 1, record + 2};
+    frontier.append(entries);
+  }
+  size_t nofRecords = 0;
+  EXPECT_FALSE(frontier.forEach([&](const uint32_t* record) {
+    ++nofRecords;
+  }));
+  EXPECT_TRUE(frontier.failed());
+  EXPECT_LT(nofRecords, 100u);
+}
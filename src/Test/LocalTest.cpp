@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/CsrGraph.hpp"
+#include "ConsensLib/Local.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+struct OddSumFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    return std::accumulate(subgraph.begin(), subgraph.end(), 0u) % 2 == 1;
+  }
+};
+
+template<bool sorted>
+std::vector<size_t> getDistances(const TestGraph<sorted>& graph, unsigned source)
+{
+  std::vector<size_t> distances(graph.nodes.size(), std::numeric_limits<size_t>::max());
+  std::vector<unsigned> queue({source});
+  distances[source] = 0;
+  for (size_t pos = 0; pos < queue.size(); ++pos) {
+    for (unsigned neighbor : graph.adjacency[queue[pos]]) {
+      if (distances[neighbor] == std::numeric_limits<size_t>::max()) {
+        distances[neighbor] = distances[queue[pos]] + 1;
+        queue.push_back(neighbor);
+      }
+    }
+  }
+  return distances;
+}
+
+/**
+ * Keep the subgraphs whose nodes are all within 'radius' of their first node, which is the
+ * smallest node with respect to the compare function the subgraphs are sorted by.
+ */
+template<bool sorted>
+std::vector<std::vector<unsigned>> getWithinRadius(
+    const TestGraph<sorted>& graph,
+    const std::vector<std::vector<unsigned>>& subgraphs,
+    size_t radius)
+{
+  std::vector<std::vector<size_t>> distances;
+  for (unsigned node = 0; node < graph.nodes.size(); ++node) {
+    distances.push_back(getDistances(graph, node));
+  }
+  std::vector<std::vector<unsigned>> result;
+  for (const std::vector<unsigned>& subgraph : subgraphs) {
+    if (std::all_of(subgraph.begin(), subgraph.end(),
+                    [&](unsigned node) { return distances[subgraph.front()][node] <= radius; })) {
+      result.push_back(subgraph);
+    }
+  }
+  return result;
+}
+
+struct LocalTestRow {
+  EdgeList edges;
+  unsigned nofNodes;
+  size_t radius;
+  size_t upperBound;
+};
+
+class LocalTest : public ::testing::TestWithParam<LocalTestRow> {};
+
+TEST_P(LocalTest, TestLocalEqualsConsensWithinRadius) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+
+  std::vector<std::vector<unsigned>> result
+      = ConsensLib::runConsensLocal(sorted, test_params.radius, test_params.upperBound);
+  checkValidity(result, sorted, test_params.upperBound);
+  EXPECT_EQ(result, getWithinRadius(sorted, ConsensLib::runConsens(sorted, test_params.upperBound), test_params.radius));
+
+  std::vector<std::vector<unsigned>> filtered
+      = ConsensLib::runConsensLocal(unsorted, test_params.radius, test_params.upperBound, OddSumFilter());
+  checkValidity(filtered, unsorted, test_params.upperBound, OddSumFilter());
+  EXPECT_EQ(filtered, getWithinRadius(unsorted,
+                                      ConsensLib::runConsens(unsorted, test_params.upperBound, OddSumFilter()),
+                                      test_params.radius));
+
+  std::vector<std::vector<unsigned>> reversed = ConsensLib::runConsensLocal(
+      unsorted, test_params.radius, test_params.upperBound, ConsensLib::NoFilter(), std::greater<unsigned>());
+  checkValidity(reversed, unsorted, test_params.upperBound, ConsensLib::NoFilter(), std::greater<unsigned>());
+  EXPECT_EQ(reversed, getWithinRadius(unsorted,
+                                      ConsensLib::runConsens(unsorted, test_params.upperBound,
+                                                             ConsensLib::NoFilter(), std::greater<unsigned>()),
+                                      test_params.radius));
+}
+
+TEST_P(LocalTest, TestIndexedGraphEqualsSortedGraph) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  std::vector<std::pair<uint32_t, uint32_t>> csrEdges(test_params.edges.begin(), test_params.edges.end());
+  ConsensLib::CsrGraph<uint32_t> csr(test_params.nofNodes, csrEdges);
+
+  // the 'index' hook of the CSR graph replaces the set of visited nodes and the binary search in the ball
+  std::vector<std::vector<uint32_t>> result
+      = ConsensLib::runConsensLocal(csr, test_params.radius, test_params.upperBound, OddSumFilter());
+  std::vector<std::vector<unsigned>> expected
+      = ConsensLib::runConsensLocal(sorted, test_params.radius, test_params.upperBound, OddSumFilter());
+  EXPECT_EQ(result, std::vector<std::vector<uint32_t>>(expected.begin(), expected.end()));
+
+  std::vector<std::vector<uint32_t>> reversed = ConsensLib::runConsensLocal(
+      csr, test_params.radius, test_params.upperBound, ConsensLib::NoFilter(), std::greater<uint32_t>());
+  std::vector<std::vector<unsigned>> expectedReversed = ConsensLib::runConsensLocal(
+      sorted, test_params.radius, test_params.upperBound, ConsensLib::NoFilter(), std::greater<unsigned>());
+  EXPECT_EQ(reversed, std::vector<std::vector<uint32_t>>(expectedReversed.begin(), expectedReversed.end()));
+}
+
+TEST_P(LocalTest, TestRootsPartitionResult) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  std::vector<std::vector<unsigned>> expected
+      = ConsensLib::runConsensLocal(sorted, test_params.radius, test_params.upperBound);
+
+  std::vector<std::vector<unsigned>> result;
+  for (unsigned root = 0; root < test_params.nofNodes; ++root) {
+    std::vector<std::vector<unsigned>> rootResult
+        = ConsensLib::runConsensLocalRoot(sorted, root, test_params.radius, test_params.upperBound);
+    for (const std::vector<unsigned>& subgraph : rootResult) {
+      EXPECT_EQ(subgraph.front(), root);
+    }
+    result.insert(result.end(), rootResult.begin(), rootResult.end());
+  }
+  EXPECT_EQ(result, expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(LocalTester, LocalTest, ::testing::Values(
+    LocalTestRow{getPathEdges(10), 10, 2, std::numeric_limits<size_t>::max()},
+    LocalTestRow{getPathEdges(10), 10, 0, std::numeric_limits<size_t>::max()},
+    LocalTestRow{getCycleEdges(11), 11, 3, std::numeric_limits<size_t>::max()},
+    LocalTestRow{getCycleEdges(11), 11, 20, 4},
+    LocalTestRow{getCliqueEdges(9), 9, 1, std::numeric_limits<size_t>::max()},
+    LocalTestRow{getGridEdges(4, 4), 16, 2, std::numeric_limits<size_t>::max()},
+    LocalTestRow{getGridEdges(6, 6), 36, 2, 5},
+    LocalTestRow{getRandomTreeEdges(25, 3), 25, 3, 8},
+    LocalTestRow{getRandomEdges(15, 0.3, 4), 15, 1, std::numeric_limits<size_t>::max()},
+    LocalTestRow{getRandomEdges(60, 0.08, 5), 60, 2, 5},
+    LocalTestRow{EdgeList(), 5, 1, std::numeric_limits<size_t>::max()},
+    LocalTestRow{EdgeList(), 0, 1, std::numeric_limits<size_t>::max()},
+    LocalTestRow{getPathEdges(6), 6, 2, 0},
+    LocalTestRow{getGridEdges(3, 3), 9, std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()}
+));
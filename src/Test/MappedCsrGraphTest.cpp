@@ -0,0 +1,142 @@
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/MappedCsrGraph.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+const std::string GRAPH_FILE = "MappedCsrGraphTest.csr";
+
+std::string getEdgeListText(const EdgeList& edges)
+{
+  std::ostringstream text;
+  text << "# test graph\n\n";
+  for (const std::pair<unsigned, unsigned>& edge : edges) {
+    text << edge.first << " " << edge.second << "\n";
+  }
+  return text.str();
+}
+
+class MappedCsrGraphTest : public ::testing::TestWithParam<GraphTestRow> {};
+
+TEST_P(MappedCsrGraphTest, TestMappedGraphEqualsCsrGraph) {
+
+  auto test_params = GetParam();
+  std::vector<std::pair<uint32_t, uint32_t>> csrEdges(test_params.edges.begin(), test_params.edges.end());
+  ConsensLib::CsrGraph<uint32_t> csr(test_params.nofNodes, csrEdges);
+  ASSERT_TRUE(ConsensLib::writeCsrFile(csr, GRAPH_FILE));
+  {
+    ConsensLib::MappedCsrGraph mapped(GRAPH_FILE);
+    ASSERT_TRUE(mapped.validate());
+    EXPECT_EQ(mapped.nofNodes(), csr.nofNodes());
+    EXPECT_EQ(mapped.nofEdges(), csr.nofEdges());
+    for (uint32_t node = 0; node < csr.nofNodes(); ++node) {
+      EXPECT_EQ(std::vector<uint32_t>(mapped.neighborsBegin(node), mapped.neighborsEnd(node)),
+                std::vector<uint32_t>(csr.neighborsBegin(node), csr.neighborsEnd(node)));
+    }
+
+    std::vector<std::vector<uint32_t>> result = ConsensLib::runConsens(mapped, test_params.upperBound);
+    checkValidity(result, mapped, test_params.upperBound);
+    EXPECT_EQ(result, ConsensLib::runConsens(csr, test_params.upperBound));
+  }
+  std::remove(GRAPH_FILE.c_str());
+}
+
+TEST_P(MappedCsrGraphTest, TestConvertEdgeList) {
+
+  auto test_params = GetParam();
+  SortedTestGraph graph(test_params.nofNodes, test_params.edges);
+  std::istringstream input(getEdgeListText(test_params.edges));
+  ASSERT_TRUE(ConsensLib::convertEdgeListToCsrFile(input, GRAPH_FILE));
+  {
+    ConsensLib::MappedCsrGraph mapped(GRAPH_FILE);
+    ASSERT_TRUE(mapped.validate());
+    // isolated nodes after the largest index of the edge list are not part of the converted graph
+    ASSERT_LE(mapped.nofNodes(), test_params.nofNodes);
+    for (uint32_t node = 0; node < test_params.nofNodes; ++node) {
+      std::vector<unsigned> neighbors;
+      if (node < mapped.nofNodes()) {
+        neighbors.assign(mapped.neighborsBegin(node), mapped.neighborsEnd(node));
+      }
+      EXPECT_EQ(neighbors, graph.adjacency[node]);
+    }
+  }
+  std::remove(GRAPH_FILE.c_str());
+}
+
+INSTANTIATE_TEST_SUITE_P(MappedCsrGraphTester, MappedCsrGraphTest, ::testing::ValuesIn(getGraphTestRows()));
+
+TEST(MappedCsrGraphFileTest, TestInvalidFiles) {
+
+  EXPECT_FALSE(ConsensLib::MappedCsrGraph("MappedCsrGraphTest.missing").valid());
+
+  std::ofstream(GRAPH_FILE, std::ios::binary) << "not a graph file";
+  EXPECT_FALSE(ConsensLib::MappedCsrGraph(GRAPH_FILE).valid());
+
+  ConsensLib::CsrGraph<uint32_t> csr(4, {{0, 1}, {1, 2}, {2, 3}});
+  ASSERT_TRUE(ConsensLib::writeCsrFile(csr, GRAPH_FILE));
+  std::string content;
+  {
+    std::ifstream input(GRAPH_FILE, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+  }
+  std::ofstream(GRAPH_FILE, std::ios::binary) << content.substr(0, content.size() - 1);
+  ConsensLib::MappedCsrGraph truncated(GRAPH_FILE);
+  EXPECT_FALSE(truncated.valid());
+  EXPECT_EQ(truncated.nofNodes(), 0u);
+  std::remove(GRAPH_FILE.c_str());
+
+  std::istringstream malformed("0 1\n1 x\n");
+  EXPECT_FALSE(ConsensLib::convertEdgeListToCsrFile(malformed, GRAPH_FILE));
+  std::remove(GRAPH_FILE.c_str());
+}
+
+TEST(MappedCsrGraphFileTest, TestValidateContent) {
+
+  ConsensLib::CsrGraph<uint32_t> csr(4, {{0, 1}, {1, 2}, {2, 3}, {0, 3}});
+  ASSERT_TRUE(ConsensLib::writeCsrFile(csr, GRAPH_FILE));
+  std::string content;
+  {
+    std::ifstream input(GRAPH_FILE, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+  }
+  EXPECT_TRUE(ConsensLib::MappedCsrGraph(GRAPH_FILE).validate());
+
+  // offsets of nodes 0 to 4 and the neighbors 1 3 | 0 2 | 1 3 | 0 2
+  size_t offsetsBegin = sizeof(ConsensLib::CsrFileHeader);
+  size_t neighborsBegin = offsetsBegin + 5 * sizeof(uint64_t);
+  auto writeCorrupted = [&](size_t position, const void* value, size_t size) {
+    std::string corrupted = content;
+    corrupted.replace(position, size, static_cast<const char*>(value), size);
+    std::ofstream(GRAPH_FILE, std::ios::binary) << corrupted;
+  };
+
+  uint64_t offset = 7;
+  writeCorrupted(offsetsBegin + 2 * sizeof(uint64_t), &offset, sizeof(offset));
+  ConsensLib::MappedCsrGraph decreasing(GRAPH_FILE);
+  EXPECT_TRUE(decreasing.valid());
+  EXPECT_FALSE(decreasing.validate());
+
+  uint32_t neighbor = 4;
+  writeCorrupted(neighborsBegin + sizeof(uint32_t), &neighbor, sizeof(neighbor));
+  ConsensLib::MappedCsrGraph outOfRange(GRAPH_FILE);
+  EXPECT_TRUE(outOfRange.valid());
+  EXPECT_FALSE(outOfRange.validate());
+
+  neighbor = 3;
+  writeCorrupted(neighborsBegin + 2 * sizeof(uint32_t), &neighbor, sizeof(neighbor));
+  ConsensLib::MappedCsrGraph unsorted(GRAPH_FILE);
+  EXPECT_TRUE(unsorted.valid());
+  EXPECT_FALSE(unsorted.validate());
+
+  EXPECT_FALSE(ConsensLib::MappedCsrGraph("MappedCsrGraphTest.missing").validate());
+  std::remove(GRAPH_FILE.c_str());
+}
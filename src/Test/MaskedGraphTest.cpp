@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/Counting.hpp"
+#include "ConsensLib/CsrGraph.hpp"
+#include "ConsensLib/GraphQueries.hpp"
+#include "ConsensLib/MaskedGraph.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+using CsrView = ConsensLib::MaskedGraph<ConsensLib::CsrGraph<uint32_t>>;
+static_assert(ConsensLib::Intern::HasIndexHook<CsrView>::value, "the view forwards index and nodeCount");
+static_assert(ConsensLib::Intern::HasIsAdjacentHook<CsrView>::value, "the view forwards isAdjacent");
+static_assert(!ConsensLib::Intern::HasDegreeHook<CsrView>::value, "the degree of the underlying graph counts masked nodes");
+static_assert(!ConsensLib::Intern::HasIndexHook<ConsensLib::MaskedGraph<SortedTestGraph>>::value,
+              "hooks are only forwarded if the underlying graph provides them");
+
+struct InsideMaskFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    return std::all_of(subgraph.begin(), subgraph.end(), mask);
+  }
+
+  ConsensLib::NodeBitMask mask;
+};
+
+std::vector<std::vector<unsigned>> getSorted(std::vector<std::vector<unsigned>> subgraphs)
+{
+  std::sort(subgraphs.begin(), subgraphs.end());
+  return subgraphs;
+}
+
+struct MaskedGraphTestRow {
+  EdgeList edges;
+  unsigned nofNodes;
+  size_t upperBound;
+  double keepProbability;
+  unsigned seed;
+};
+
+class MaskedGraphTest : public ::testing::TestWithParam<MaskedGraphTestRow> {};
+
+TEST_P(MaskedGraphTest, TestMaskedEqualsInducedSubgraphs) {
+
+  auto test_params = GetParam();
+  std::mt19937 generator(test_params.seed);
+  std::bernoulli_distribution keep(test_params.keepProbability);
+  ConsensLib::NodeBitMask mask(test_params.nofNodes);
+  for (unsigned node = 0; node < test_params.nofNodes; ++node) {
+    if (keep(generator)) {
+      mask.set(node);
+    }
+  }
+  // the connected induced subgraphs of the view are those of the graph inside the mask
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  std::vector<std::vector<unsigned>> expected
+      = getSorted(ConsensLib::runConsens(sorted, test_params.upperBound, InsideMaskFilter{mask}));
+
+  ConsensLib::MaskedGraph<SortedTestGraph> sortedView(sorted, mask);
+  std::vector<std::vector<unsigned>> sortedResult = ConsensLib::runConsens(sortedView, test_params.upperBound);
+  EXPECT_EQ(getSorted(sortedResult), expected);
+  checkValidity(sortedResult, sortedView, test_params.upperBound);
+
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+  auto unsortedView = ConsensLib::makeMaskedGraph(unsorted, [&mask](unsigned node) {
+    return mask.contains(node);
+  });
+  std::vector<std::vector<unsigned>> unsortedResult = ConsensLib::runConsens(unsortedView, test_params.upperBound);
+  EXPECT_EQ(getSorted(unsortedResult), expected);
+  checkValidity(unsortedResult, unsortedView, test_params.upperBound);
+
+  std::vector<std::pair<uint32_t, uint32_t>> csrEdges(test_params.edges.begin(), test_params.edges.end());
+  ConsensLib::CsrGraph<uint32_t> csr(test_params.nofNodes, csrEdges);
+  CsrView csrView(csr, mask);
+  // the forwarded 'index' hook runs the enumeration on dense arrays of the underlying index range
+  std::vector<std::vector<uint32_t>> csrResult = ConsensLib::runConsens(csrView, test_params.upperBound);
+  EXPECT_EQ(getSorted(csrResult), expected);
+  for (uint32_t n1 = 0; n1 < test_params.nofNodes; ++n1) {
+    for (uint32_t n2 = 0; n2 < test_params.nofNodes; ++n2) {
+      bool adjacent = ConsensLib::areAdjacent(n1, n2, csrView);
+      EXPECT_EQ(adjacent, mask(n1) && mask(n2) && csr.isAdjacent(n1, n2));
+      if (mask(n1)) {
+        EXPECT_EQ(ConsensLib::areAdjacent(n1, n2, sortedView), adjacent);
+      }
+    }
+  }
+
+  std::vector<size_t> counts = ConsensLib::countConsens(csrView, test_params.upperBound);
+  std::vector<size_t> expectedCounts(counts.size(), 0);
+  for (const std::vector<unsigned>& subgraph : expected) {
+    ++expectedCounts.at(subgraph.size());
+  }
+  EXPECT_EQ(counts, expectedCounts);
+}
+
+INSTANTIATE_TEST_SUITE_P(MaskedGraphTester, MaskedGraphTest, ::testing::Values(
+    MaskedGraphTestRow{getPathEdges(10), 10, std::numeric_limits<size_t>::max(), 0.7, 1},
+    MaskedGraphTestRow{getCycleEdges(12), 12, std::numeric_limits<size_t>::max(), 0.8, 2},
+    MaskedGraphTestRow{getCliqueEdges(9), 9, std::numeric_limits<size_t>::max(), 0.6, 3},
+    MaskedGraphTestRow{getGridEdges(5, 5), 25, 7, 0.75, 4},
+    MaskedGraphTestRow{getRandomTreeEdges(20, 5), 20, std::numeric_limits<size_t>::max(), 0.8, 5},
+    MaskedGraphTestRow{getRandomEdges(70, 0.08, 6), 70, 5, 0.7, 6},
+    MaskedGraphTestRow{getRandomEdges(16, 0.3, 7), 16, std::numeric_limits<size_t>::max(), 1.0, 7},
+    MaskedGraphTestRow{getRandomEdges(16, 0.3, 8), 16, std::numeric_limits<size_t>::max(), 0.0, 8},
+    MaskedGraphTestRow{EdgeList(), 0, std::numeric_limits<size_t>::max(), 0.5, 9}
+));
+
+TEST(NodeBitMaskTest, TestMembership) {
+
+  std::vector<unsigned> nodes{0, 5, 63, 64, 129};
+  ConsensLib::NodeBitMask mask(130, nodes.begin(), nodes.end());
+  for (unsigned node = 0; node < 200; ++node) {
+    EXPECT_EQ(mask(node), std::find(nodes.begin(), nodes.end(), node) != nodes.end());
+  }
+  mask.reset(63);
+  mask.set(1);
+  EXPECT_FALSE(mask(63));
+  EXPECT_TRUE(mask(1));
+
+  ConsensLib::NodeBitMask full(70, true);
+  EXPECT_TRUE(full(0));
+  EXPECT_TRUE(full(69));
+  EXPECT_FALSE(full(70));
+}
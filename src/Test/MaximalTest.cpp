@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/Maximal.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+enum class Property {
+  PATH,
+  TREE,
+  CLIQUE
+};
+
+struct PropertyFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    size_t degreeSum = 0;
+    size_t maxDegree = 0;
+    for (unsigned node : subgraph) {
+      size_t degree = 0;
+      for (unsigned neighbor : adjacency->at(node)) {
+        if (std::binary_search(subgraph.begin(), subgraph.end(), neighbor)) {
+          ++degree;
+        }
+      }
+      degreeSum += degree;
+      maxDegree = std::max(maxDegree, degree);
+    }
+    size_t nofEdges = degreeSum / 2;
+    switch (property) {
+      case Property::PATH:
+        return maxDegree <= 2 && nofEdges + 1 == subgraph.size();
+      case Property::TREE:
+        return nofEdges + 1 == subgraph.size();
+      case Property::CLIQUE:
+        return 2 * nofEdges == subgraph.size() * (subgraph.size() - 1);
+    }
+    return false;
+  }
+
+  const std::vector<std::vector<unsigned>>* adjacency;
+  Property property;
+};
+
+/**
+ * Remove all subgraphs that are contained in another subgraph.
+ */
+std::vector<std::vector<unsigned>> removeDominated(const std::vector<std::vector<unsigned>>& subgraphs)
+{
+  std::vector<std::vector<unsigned>> maximal;
+  for (const std::vector<unsigned>& subgraph : subgraphs) {
+    bool dominated = std::any_of(subgraphs.begin(), subgraphs.end(), [&subgraph](const std::vector<unsigned>& other) {
+      return other.size() > subgraph.size()
+          && std::includes(other.begin(), other.end(), subgraph.begin(), subgraph.end());
+    });
+    if (!dominated) {
+      maximal.push_back(subgraph);
+    }
+  }
+  return maximal;
+}
+
+struct MaximalTestRow {
+  EdgeList edges;
+  unsigned nofNodes;
+  size_t upperBound;
+  Property property;
+};
+
+class MaximalTest : public ::testing::TestWithParam<MaximalTestRow> {};
+
+TEST_P(MaximalTest, TestMaximalEqualsDominatedRemoval) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+  PropertyFilter filter{&sorted.adjacency, test_params.property};
+
+  std::vector<std::vector<unsigned>> expected
+      = removeDominated(ConsensLib::runConsens(sorted, test_params.upperBound, filter));
+
+  std::vector<std::vector<unsigned>> result = ConsensLib::runConsensMaximal(sorted, filter, test_params.upperBound);
+  EXPECT_EQ(result, expected);
+  checkValidity(result, sorted, test_params.upperBound, filter);
+
+  EXPECT_EQ(ConsensLib::runConsensMaximal(unsorted, filter, test_params.upperBound), expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(MaximalTester, MaximalTest, ::testing::Values(
+    MaximalTestRow{getPathEdges(7), 7, std::numeric_limits<size_t>::max(), Property::PATH},
+    MaximalTestRow{getPathEdges(7), 7, 3, Property::PATH},
+    MaximalTestRow{getCycleEdges(8), 8, std::numeric_limits<size_t>::max(), Property::PATH},
+    MaximalTestRow{getGridEdges(3, 4), 12, std::numeric_limits<size_t>::max(), Property::PATH},
+    MaximalTestRow{getGridEdges(3, 4), 12, std::numeric_limits<size_t>::max(), Property::TREE},
+    MaximalTestRow{getRandomEdges(14, 0.3, 4), 14, std::numeric_limits<size_t>::max(), Property::TREE},
+    MaximalTestRow{getRandomEdges(14, 0.3, 4), 14, 5, Property::PATH},
+    MaximalTestRow{getRandomEdges(14, 0.5, 7), 14, std::numeric_limits<size_t>::max(), Property::CLIQUE},
+    MaximalTestRow{getCliqueEdges(6), 6, std::numeric_limits<size_t>::max(), Property::PATH},
+    MaximalTestRow{getCliqueEdges(6), 6, 0, Property::CLIQUE},
+    MaximalTestRow{EdgeList(), 3, std::numeric_limits<size_t>::max(), Property::CLIQUE}
+));
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/Ordering.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+struct ContainsZeroFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    return !subgraph.empty() && subgraph.front() == 0;
+  }
+};
+
+struct GreaterCompare {
+  bool operator()(unsigned n1, unsigned n2) const
+  {
+    return n1 > n2;
+  }
+};
+
+/**
+ * Collects the emitted subgraphs and prunes every subgraph with 'limit' nodes.
+ */
+struct SizePruningVisitor : public ConsensLib::EnumerationVisitor
+{
+  SizePruningVisitor(size_t limit) : limit(limit) {}
+
+  void emit(const std::vector<unsigned>& subgraph)
+  {
+    subgraphs.push_back(subgraph);
+  }
+
+  bool expand(const std::vector<unsigned>& current, const std::vector<unsigned>& candidates)
+  {
+    for (unsigned candidate : candidates) {
+      EXPECT_FALSE(std::binary_search(current.begin(), current.end(), candidate));
+    }
+    return current.size() < limit;
+  }
+
+  size_t limit;
+  std::vector<std::vector<unsigned>> subgraphs;
+};
+
+class OrderingTest : public ::testing::TestWithParam<GraphTestRow> {};
+
+TEST_P(OrderingTest, TestOrderedEnumeration) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+
+  std::vector<std::vector<unsigned>> expected = ConsensLib::runConsens(sorted, test_params.upperBound);
+  std::vector<std::vector<unsigned>> expectedFiltered
+      = ConsensLib::runConsens(sorted, test_params.upperBound, ContainsZeroFilter());
+  std::sort(expected.begin(), expected.end());
+  std::sort(expectedFiltered.begin(), expectedFiltered.end());
+
+  for (ConsensLib::NodeOrder order : {ConsensLib::NodeOrder::COMPARE,
+                                      ConsensLib::NodeOrder::DEGREE_DESCENDING,
+                                      ConsensLib::NodeOrder::DEGENERACY,
+                                      ConsensLib::NodeOrder::CUTHILL_MCKEE,
+                                      ConsensLib::NodeOrder::RANDOM}) {
+    std::vector<std::vector<unsigned>> result
+        = ConsensLib::runConsensOrdered(unsorted, order, test_params.upperBound);
+    checkValidity(result, unsorted, test_params.upperBound);
+    std::sort(result.begin(), result.end());
+    EXPECT_EQ(result, expected);
+
+    std::vector<std::vector<unsigned>> filtered
+        = ConsensLib::runConsensOrdered(sorted, order, test_params.upperBound, ContainsZeroFilter());
+    std::sort(filtered.begin(), filtered.end());
+    EXPECT_EQ(filtered, expectedFiltered);
+
+    std::vector<std::vector<unsigned>> reversed
+        = ConsensLib::runConsensOrdered(unsorted, order, test_params.upperBound,
+                                        ConsensLib::NoFilter(), GreaterCompare(), 17);
+    checkValidity(reversed, unsorted, test_params.upperBound, ConsensLib::NoFilter(), GreaterCompare());
+    EXPECT_EQ(reversed.size(), expected.size());
+  }
+}
+
+TEST_P(OrderingTest, TestCompareOrderKeepsSequence) {
+
+  auto test_params = GetParam();
+  SortedTestGraph graph(test_params.nofNodes, test_params.edges);
+
+  EXPECT_EQ(ConsensLib::runConsensOrdered(graph, ConsensLib::NodeOrder::COMPARE, test_params.upperBound),
+            ConsensLib::runConsens(graph, test_params.upperBound));
+}
+
+TEST_P(OrderingTest, TestVisitorPrunes) {
+
+  auto test_params = GetParam();
+  SortedTestGraph graph(test_params.nofNodes, test_params.edges);
+  std::vector<std::vector<unsigned>> expected = ConsensLib::runConsens(graph, std::min<size_t>(test_params.upperBound, 3));
+  std::sort(expected.begin(), expected.end());
+
+  for (ConsensLib::NodeOrder order : {ConsensLib::NodeOrder::COMPARE, ConsensLib::NodeOrder::DEGENERACY}) {
+    SizePruningVisitor visitor(3);
+    ConsensLib::Intern::visitOrderedEnumeration<SortedTestGraph, unsigned>(
+        graph, order, test_params.upperBound, ConsensLib::NoFilter(), visitor, std::less<unsigned>(), 0);
+    std::sort(visitor.subgraphs.begin(), visitor.subgraphs.end());
+    EXPECT_EQ(visitor.subgraphs, expected);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(OrderingTester, OrderingTest, ::testing::Values(
+    GraphTestRow{getPathEdges(7), 7, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getCycleEdges(8), 8, 5},
+    GraphTestRow{getCliqueEdges(6), 6, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getGridEdges(3, 4), 12, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getRandomTreeEdges(15, 3), 15, 6},
+    GraphTestRow{getRandomEdges(16, 0.25, 11), 16, 5},
+    GraphTestRow{EdgeList(), 3, std::numeric_limits<size_t>::max()}
+));
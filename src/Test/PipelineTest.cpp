@@ -0,0 +1,124 @@
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/Pipeline.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+struct CountingFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    ++*calls;
+    unsigned sum = 0;
+    for (unsigned node : subgraph) {
+      sum += node;
+    }
+    return sum % 3 == 0;
+  }
+
+  std::atomic<size_t>* calls;
+};
+
+struct ThrowingFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    if (subgraph.size() == 4) {
+      throw std::runtime_error("filter failed");
+    }
+    return true;
+  }
+};
+
+struct CollectingVisitor : public ConsensLib::EnumerationVisitor
+{
+  void emit(const std::vector<unsigned>& subgraph)
+  {
+    if (subgraphs.size() == limit) {
+      throw std::length_error("too many subgraphs");
+    }
+    subgraphs.push_back(subgraph);
+  }
+
+  size_t limit = std::numeric_limits<size_t>::max();
+  std::vector<std::vector<unsigned>> subgraphs;
+};
+
+TEST(PipelineFailureTest, TestFilterExceptionIsRethrown) {
+
+  SortedTestGraph graph(16, getGridEdges(4, 4));
+  for (size_t nofThreads : {1, 4}) {
+    EXPECT_THROW(ConsensLib::runConsensPipelined(graph, ThrowingFilter(), std::numeric_limits<size_t>::max(),
+                                                 std::less<unsigned>(), nofThreads, 8, 2),
+                 std::runtime_error);
+  }
+}
+
+TEST(PipelineFailureTest, TestVisitorExceptionJoinsWorkers) {
+
+  SortedTestGraph graph(16, getGridEdges(4, 4));
+  std::atomic<size_t> calls(0);
+  CollectingVisitor visitor;
+  visitor.limit = 100;
+  EXPECT_THROW(ConsensLib::runConsensPipelinedVisitor(graph, visitor, CountingFilter{&calls},
+                                                      std::numeric_limits<size_t>::max(), std::less<unsigned>(),
+                                                      4, 8, 2),
+               std::length_error);
+  EXPECT_EQ(visitor.subgraphs.size(), 100u);
+}
+
+struct PipelineTestRow {
+  EdgeList edges;
+  unsigned nofNodes;
+  size_t upperBound;
+  size_t nofThreads;
+  size_t batchSize;
+  size_t queueCapacity;
+};
+
+class PipelineTest : public ::testing::TestWithParam<PipelineTestRow> {};
+
+TEST_P(PipelineTest, TestPipelineEqualsSequential) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+
+  std::atomic<size_t> calls(0);
+  CountingFilter filter{&calls};
+
+  std::vector<std::vector<unsigned>> expected = ConsensLib::runConsens(sorted, test_params.upperBound, filter);
+  size_t nofSubgraphs = calls.load();
+  calls.store(0);
+
+  std::vector<std::vector<unsigned>> result = ConsensLib::runConsensPipelined(
+      sorted, filter, test_params.upperBound, std::less<unsigned>(),
+      test_params.nofThreads, test_params.batchSize, test_params.queueCapacity);
+  EXPECT_EQ(result, expected);
+  EXPECT_EQ(calls.load(), nofSubgraphs);
+  checkValidity(result, sorted, test_params.upperBound, filter);
+
+  std::vector<std::vector<unsigned>> unsortedResult = ConsensLib::runConsensPipelined(
+      unsorted, filter, test_params.upperBound, std::less<unsigned>(),
+      test_params.nofThreads, test_params.batchSize, test_params.queueCapacity);
+  EXPECT_EQ(unsortedResult, expected);
+
+  CollectingVisitor visitor;
+  ConsensLib::runConsensPipelinedVisitor(sorted, visitor, filter, test_params.upperBound, std::less<unsigned>(),
+                                         test_params.nofThreads, test_params.batchSize, test_params.queueCapacity);
+  EXPECT_EQ(visitor.subgraphs, expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(PipelineTester, PipelineTest, ::testing::Values(
+    PipelineTestRow{getGridEdges(4, 4), 16, std::numeric_limits<size_t>::max(), 1, 1, 1},
+    PipelineTestRow{getGridEdges(4, 4), 16, std::numeric_limits<size_t>::max(), 4, 7, 2},
+    PipelineTestRow{getRandomEdges(18, 0.25, 3), 18, 7, 3, 256, 64},
+    PipelineTestRow{getCliqueEdges(12), 12, std::numeric_limits<size_t>::max(), 8, 64, 4},
+    PipelineTestRow{getPathEdges(5), 5, 0, 2, 16, 4},
+    PipelineTestRow{EdgeList(), 0, std::numeric_limits<size_t>::max(), 2, 16, 4}
+));
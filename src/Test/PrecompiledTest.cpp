@@ -0,0 +1,109 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/Precompiled.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+template<typename Index>
+ConsensLib::CsrGraph<Index> getCsrGraph(unsigned nofNodes, const EdgeList& edges)
+{
+  std::vector<std::pair<Index, Index>> indexEdges;
+  for (const std::pair<unsigned, unsigned>& edge : edges) {
+    indexEdges.emplace_back(static_cast<Index>(edge.first), static_cast<Index>(edge.second));
+  }
+  return ConsensLib::CsrGraph<Index>(nofNodes, indexEdges);
+}
+
+// CsrGraph dispatches to the recursion on dense arrays, which is the code instantiated in the engine.
+static_assert(ConsensLib::Intern::HasIndexHook<ConsensLib::CsrGraph<uint16_t>>::value, "CsrGraph provides index");
+static_assert(ConsensLib::Intern::HasIndexHook<ConsensLib::CsrGraph<uint32_t>>::value, "CsrGraph provides index");
+
+/**
+ * The instantiations are declared extern in Precompiled.hpp, so this translation unit does not define them
+ * and only links if the engine provides every one of them.
+ */
+TEST(PrecompiledInstantiationTest, TestInstantiationsAreLinked) {
+
+  using Collector16 = ConsensLib::Intern::SubgraphCollector<uint16_t>;
+  using Collector32 = ConsensLib::Intern::SubgraphCollector<uint32_t>;
+  void (*visit16)(const ConsensLib::CsrGraph<uint16_t>&, const std::vector<uint16_t>&, size_t,
+                  const ConsensLib::NoFilter&, Collector16&, const std::less<uint16_t>&, std::true_type)
+      = &ConsensLib::Intern::visitEnumeration<ConsensLib::CsrGraph<uint16_t>, uint16_t, ConsensLib::NoFilter,
+                                              std::less<uint16_t>, Collector16>;
+  void (*visit32)(const ConsensLib::CsrGraph<uint32_t>&, const std::vector<uint32_t>&, size_t,
+                  const ConsensLib::NoFilter&, Collector32&, const std::less<uint32_t>&, std::true_type)
+      = &ConsensLib::Intern::visitEnumeration<ConsensLib::CsrGraph<uint32_t>, uint32_t, ConsensLib::NoFilter,
+                                              std::less<uint32_t>, Collector32>;
+
+  ConsensLib::CsrGraph<uint16_t> graph16 = getCsrGraph<uint16_t>(4, getCycleEdges(4));
+  ConsensLib::CsrGraph<uint32_t> graph32 = getCsrGraph<uint32_t>(4, getCycleEdges(4));
+  Collector16 collector16;
+  Collector32 collector32;
+  visit16(graph16, {0, 1, 2, 3}, 2, ConsensLib::NoFilter(), collector16, std::less<uint16_t>(), std::true_type());
+  visit32(graph32, {0, 1, 2, 3}, 2, ConsensLib::NoFilter(), collector32, std::less<uint32_t>(), std::true_type());
+  EXPECT_EQ(collector16.subgraphs.size(), 8u);
+  EXPECT_EQ(collector32.subgraphs.size(), 8u);
+
+  std::vector<std::vector<uint32_t>> (*run32)(const ConsensLib::CsrGraph<uint32_t>&, size_t,
+                                              const ConsensLib::NoFilter&, const std::less<uint32_t>&)
+      = &ConsensLib::Intern::runEnumeration<ConsensLib::CsrGraph<uint32_t>, uint32_t, ConsensLib::NoFilter,
+                                            std::less<uint32_t>>;
+  EXPECT_EQ(run32(graph32, 2, ConsensLib::NoFilter(), std::less<uint32_t>()), collector32.subgraphs);
+}
+
+class PrecompiledTest : public ::testing::TestWithParam<GraphTestRow> {};
+
+TEST_P(PrecompiledTest, TestPrecompiledEqualsTemplate) {
+
+  auto test_params = GetParam();
+  SortedTestGraph graph(test_params.nofNodes, test_params.edges);
+  ConsensLib::CsrGraph<uint16_t> graph16 = getCsrGraph<uint16_t>(test_params.nofNodes, test_params.edges);
+  ConsensLib::CsrGraph<uint32_t> graph32 = getCsrGraph<uint32_t>(test_params.nofNodes, test_params.edges);
+
+  std::vector<std::vector<unsigned>> expected = ConsensLib::runConsens(graph, test_params.upperBound);
+
+  std::vector<std::vector<uint16_t>> result16 = ConsensLib::Precompiled::runConsens(graph16, test_params.upperBound);
+  std::vector<std::vector<uint32_t>> result32 = ConsensLib::Precompiled::runConsens(graph32, test_params.upperBound);
+  checkValidity(result16, graph16, test_params.upperBound);
+  checkValidity(result32, graph32, test_params.upperBound);
+
+  ASSERT_EQ(result16.size(), expected.size());
+  ASSERT_EQ(result32.size(), expected.size());
+  for (unsigned i = 0; i < expected.size(); ++i) {
+    EXPECT_TRUE(std::equal(expected.at(i).begin(), expected.at(i).end(),
+                           result16.at(i).begin(), result16.at(i).end()));
+    EXPECT_TRUE(std::equal(expected.at(i).begin(), expected.at(i).end(),
+                           result32.at(i).begin(), result32.at(i).end()));
+  }
+
+  EXPECT_EQ(ConsensLib::runConsens(graph32, test_params.upperBound), result32);
+
+  std::vector<std::vector<uint32_t>> ordered = ConsensLib::Precompiled::runConsensOrdered(
+      graph32, ConsensLib::NodeOrder::DEGREE_DESCENDING, test_params.upperBound);
+  std::sort(ordered.begin(), ordered.end());
+  std::sort(result32.begin(), result32.end());
+  EXPECT_EQ(ordered, result32);
+
+  std::vector<size_t> histogram(std::min<size_t>(test_params.upperBound, test_params.nofNodes) + 1, 0);
+  for (const std::vector<unsigned>& subgraph : expected) {
+    ++histogram.at(subgraph.size());
+  }
+  EXPECT_EQ(ConsensLib::Precompiled::countConsens(graph16, test_params.upperBound), histogram);
+  EXPECT_EQ(ConsensLib::Precompiled::countConsens(graph32, test_params.upperBound), histogram);
+}
+
+INSTANTIATE_TEST_SUITE_P(PrecompiledTester, PrecompiledTest, ::testing::Values(
+    GraphTestRow{getPathEdges(8), 8, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getCliqueEdges(6), 6, 4},
+    GraphTestRow{getGridEdges(4, 3), 12, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getRandomEdges(15, 0.3, 21), 15, 6},
+    GraphTestRow{EdgeList(), 0, std::numeric_limits<size_t>::max()}
+));
@@ -121,6 +121,7 @@ TEST_P(SimpleGraphTest, TestEnumeration) {
   EXPECT_EQ(result.size(), test_params.nofResults);
 
   checkValidity(result, *graph, test_params.upperBound);
+  checkCompleteness(result, *graph, test_params.upperBound);
 }
 
 INSTANTIATE_TEST_SUITE_P(CliqueTester, SimpleGraphTest, ::testing::Values(
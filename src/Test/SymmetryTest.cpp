@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/CsrGraph.hpp"
+#include "ConsensLib/Symmetry.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+struct EvenSizeFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    return subgraph.size() % 2 == 0;
+  }
+};
+
+ConsensLib::Intern::AutomorphismGroup getAutomorphisms(unsigned nofNodes, const EdgeList& edges, size_t maxGroupSize)
+{
+  std::vector<std::pair<uint32_t, uint32_t>> indexEdges(edges.begin(), edges.end());
+  return ConsensLib::Intern::enumerateAutomorphisms(ConsensLib::CsrGraph<uint32_t>(nofNodes, indexEdges), maxGroupSize);
+}
+
+/**
+ * Keep the first subgraph of every orbit in the order of the enumeration and count the orbit.
+ */
+std::vector<ConsensLib::OrbitRepresentative<unsigned>> getFirstOfOrbits(
+    const std::vector<std::vector<unsigned>>& subgraphs,
+    const ConsensLib::Intern::AutomorphismGroup& group)
+{
+  std::set<std::vector<unsigned>> seen;
+  std::vector<ConsensLib::OrbitRepresentative<unsigned>> result;
+  for (const std::vector<unsigned>& subgraph : subgraphs) {
+    if (seen.count(subgraph) > 0) {
+      continue;
+    }
+    std::set<std::vector<unsigned>> orbit;
+    for (const std::vector<uint32_t>& automorphism : group.elements) {
+      std::vector<unsigned> image;
+      for (unsigned node : subgraph) {
+        image.push_back(automorphism.at(node));
+      }
+      std::sort(image.begin(), image.end());
+      orbit.insert(image);
+    }
+    seen.insert(orbit.begin(), orbit.end());
+    result.push_back(ConsensLib::OrbitRepresentative<unsigned>{subgraph, orbit.size()});
+  }
+  return result;
+}
+
+struct SymmetryTestRow {
+  EdgeList edges;
+  unsigned nofNodes;
+  size_t upperBound;
+  size_t groupSize;
+};
+
+class SymmetryTest : public ::testing::TestWithParam<SymmetryTestRow> {};
+
+TEST_P(SymmetryTest, TestAutomorphismGroup) {
+
+  auto test_params = GetParam();
+  ConsensLib::Intern::AutomorphismGroup group
+      = getAutomorphisms(test_params.nofNodes, test_params.edges, std::numeric_limits<size_t>::max());
+  EXPECT_TRUE(group.complete);
+  EXPECT_EQ(group.elements.size(), test_params.groupSize);
+  std::set<std::pair<unsigned, unsigned>> edges;
+  for (const std::pair<unsigned, unsigned>& edge : test_params.edges) {
+    edges.insert(edge);
+    edges.emplace(edge.second, edge.first);
+  }
+  std::set<std::vector<uint32_t>> distinct(group.elements.begin(), group.elements.end());
+  EXPECT_EQ(distinct.size(), group.elements.size());
+  for (const std::vector<uint32_t>& automorphism : group.elements) {
+    ASSERT_EQ(automorphism.size(), test_params.nofNodes);
+    EXPECT_EQ(std::set<uint32_t>(automorphism.begin(), automorphism.end()).size(), test_params.nofNodes);
+    for (const std::pair<unsigned, unsigned>& edge : edges) {
+      EXPECT_EQ(edges.count({automorphism[edge.first], automorphism[edge.second]}), 1u);
+    }
+  }
+}
+
+TEST_P(SymmetryTest, TestRepresentativesCoverOrbits) {
+
+  auto test_params = GetParam();
+  SortedTestGraph graph(test_params.nofNodes, test_params.edges);
+  ConsensLib::Intern::AutomorphismGroup group
+      = getAutomorphisms(test_params.nofNodes, test_params.edges, std::numeric_limits<size_t>::max());
+  std::vector<std::vector<unsigned>> subgraphs = ConsensLib::runConsens(graph, test_params.upperBound);
+  std::vector<ConsensLib::OrbitRepresentative<unsigned>> expected = getFirstOfOrbits(subgraphs, group);
+
+  std::vector<ConsensLib::OrbitRepresentative<unsigned>> result = ConsensLib::runConsensOrbits(graph, test_params.upperBound);
+  ASSERT_EQ(result.size(), expected.size());
+  size_t nofSubgraphs = 0;
+  for (size_t idx = 0; idx < result.size(); ++idx) {
+    EXPECT_EQ(result[idx].subgraph, expected[idx].subgraph);
+    EXPECT_EQ(result[idx].orbitSize, expected[idx].orbitSize);
+    nofSubgraphs += result[idx].orbitSize;
+  }
+  EXPECT_EQ(nofSubgraphs, subgraphs.size());
+
+  std::vector<std::vector<unsigned>> filtered;
+  for (const ConsensLib::OrbitRepresentative<unsigned>& representative
+       : ConsensLib::runConsensOrbits(graph, test_params.upperBound, EvenSizeFilter())) {
+    filtered.push_back(representative.subgraph);
+  }
+  std::vector<std::vector<unsigned>> expectedFiltered;
+  for (const ConsensLib::OrbitRepresentative<unsigned>& representative : expected) {
+    if (EvenSizeFilter()(representative.subgraph)) {
+      expectedFiltered.push_back(representative.subgraph);
+    }
+  }
+  EXPECT_EQ(filtered, expectedFiltered);
+  checkValidity(filtered, graph, test_params.upperBound, EvenSizeFilter());
+}
+
+TEST_P(SymmetryTest, TestLimitedGroupSize) {
+
+  auto test_params = GetParam();
+  UnsortedTestGraph graph(test_params.nofNodes, test_params.edges);
+  ConsensLib::Intern::AutomorphismGroup group = getAutomorphisms(test_params.nofNodes, test_params.edges, 4);
+  EXPECT_LE(group.elements.size(), 4u);
+  EXPECT_EQ(group.complete, test_params.groupSize <= 4);
+  std::vector<ConsensLib::OrbitRepresentative<unsigned>> expected
+      = getFirstOfOrbits(ConsensLib::runConsens(graph, test_params.upperBound), group);
+
+  std::vector<ConsensLib::OrbitRepresentative<unsigned>> result = ConsensLib::runConsensOrbits(
+      graph, test_params.upperBound, ConsensLib::NoFilter(), std::less<unsigned>(), 4);
+  ASSERT_EQ(result.size(), expected.size());
+  for (size_t idx = 0; idx < result.size(); ++idx) {
+    EXPECT_EQ(result[idx].subgraph, expected[idx].subgraph);
+    EXPECT_EQ(result[idx].orbitSize, expected[idx].orbitSize);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(SymmetryTester, SymmetryTest, ::testing::Values(
+    SymmetryTestRow{getPathEdges(7), 7, std::numeric_limits<size_t>::max(), 2},
+    SymmetryTestRow{getCycleEdges(6), 6, std::numeric_limits<size_t>::max(), 12},
+    SymmetryTestRow{getCycleEdges(13), 13, 6, 26},
+    SymmetryTestRow{getCliqueEdges(6), 6, std::numeric_limits<size_t>::max(), 720},
+    SymmetryTestRow{getGridEdges(4, 4), 16, 7, 8},
+    SymmetryTestRow{getGridEdges(3, 5), 15, std::numeric_limits<size_t>::max(), 4},
+    // the Petersen graph
+    SymmetryTestRow{EdgeList{{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0},
+                             {0, 5}, {1, 6}, {2, 7}, {3, 8}, {4, 9},
+                             {5, 7}, {7, 9}, {9, 6}, {6, 8}, {8, 5}}, 10, std::numeric_limits<size_t>::max(), 120},
+    // naphthalene: two hexagons sharing an edge
+    SymmetryTestRow{EdgeList{{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 5}, {5, 0},
+                             {4, 6}, {6, 7}, {7, 8}, {8, 9}, {9, 5}}, 10, std::numeric_limits<size_t>::max(), 4},
+    SymmetryTestRow{EdgeList{{0, 1}, {0, 2}, {0, 3}, {0, 4}, {0, 5}}, 6, std::numeric_limits<size_t>::max(), 120},
+    SymmetryTestRow{EdgeList(), 4, std::numeric_limits<size_t>::max(), 24},
+    SymmetryTestRow{EdgeList(), 0, std::numeric_limits<size_t>::max(), 1}
+));
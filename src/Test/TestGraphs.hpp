@@ -0,0 +1,183 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "ConsensLib/GraphTraits.hpp"
+
+template<bool sorted>
+struct TestGraph {
+
+  TestGraph(size_t nofNodes, const std::vector<std::pair<unsigned, unsigned>>& edges)
+    : nodes(nofNodes),
+      adjacency(nofNodes)
+  {
+    std::iota(nodes.begin(), nodes.end(), 0u);
+    for (const std::pair<unsigned, unsigned>& edge : edges) {
+      adjacency.at(edge.first).push_back(edge.second);
+      adjacency.at(edge.second).push_back(edge.first);
+    }
+    for (std::vector<unsigned>& neighbors : adjacency) {
+      std::sort(neighbors.begin(), neighbors.end());
+      neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+      if (!sorted) {
+        std::reverse(neighbors.begin(), neighbors.end());
+      }
+    }
+  }
+
+  std::vector<unsigned> nodes;
+  std::vector<std::vector<unsigned>> adjacency;
+};
+
+using SortedTestGraph = TestGraph<true>;
+using UnsortedTestGraph = TestGraph<false>;
+
+namespace ConsensLib {
+
+template<bool sorted>
+struct GraphTraits<TestGraph<sorted>> {
+  using Node = unsigned;
+  using Iterator = std::vector<unsigned>::const_iterator;
+  static Iterator adjancencyBegin(
+      const Node& node,
+      const TestGraph<sorted>& graph)
+  {
+    return graph.adjacency.at(node).begin();
+  }
+
+  static Iterator adjancencyEnd(
+      const Node& node,
+      const TestGraph<sorted>& graph)
+  {
+    return graph.adjacency.at(node).end();
+  }
+
+  static Iterator nodesBegin(const TestGraph<sorted>& graph)
+  {
+    return graph.nodes.begin();
+  }
+
+  static Iterator nodesEnd(const TestGraph<sorted>& graph)
+  {
+    return graph.nodes.end();
+  }
+
+  static constexpr bool listsSorted() {
+    return sorted;
+  }
+};
+}
+
+using EdgeList = std::vector<std::pair<unsigned, unsigned>>;
+
+inline EdgeList getPathEdges(unsigned nofNodes)
+{
+  EdgeList edges;
+  for (unsigned idx = 1; idx < nofNodes; ++idx) {
+    edges.emplace_back(idx - 1, idx);
+  }
+  return edges;
+}
+
+inline EdgeList getCycleEdges(unsigned nofNodes)
+{
+  EdgeList edges = getPathEdges(nofNodes);
+  if (nofNodes > 2) {
+    edges.emplace_back(nofNodes - 1, 0);
+  }
+  return edges;
+}
+
+inline EdgeList getCliqueEdges(unsigned nofNodes)
+{
+  EdgeList edges;
+  for (unsigned i = 0; i < nofNodes; ++i) {
+    for (unsigned j = i + 1; j < nofNodes; ++j) {
+      edges.emplace_back(i, j);
+    }
+  }
+  return edges;
+}
+
+inline EdgeList getGridEdges(unsigned width, unsigned height)
+{
+  EdgeList edges;
+  for (unsigned y = 0; y < height; ++y) {
+    for (unsigned x = 0; x < width; ++x) {
+      unsigned idx = y * width + x;
+      if (x + 1 < width) {
+        edges.emplace_back(idx, idx + 1);
+      }
+      if (y + 1 < height) {
+        edges.emplace_back(idx, idx + width);
+      }
+    }
+  }
+  return edges;
+}
+
+inline EdgeList getRandomTreeEdges(unsigned nofNodes, unsigned seed)
+{
+  std::mt19937 generator(seed);
+  EdgeList edges;
+  for (unsigned idx = 1; idx < nofNodes; ++idx) {
+    std::uniform_int_distribution<unsigned> parent(0, idx - 1);
+    edges.emplace_back(parent(generator), idx);
+  }
+  return edges;
+}
+
+inline EdgeList getRandomEdges(unsigned nofNodes, double probability, unsigned seed)
+{
+  std::mt19937 generator(seed);
+  std::bernoulli_distribution coin(probability);
+  EdgeList edges;
+  for (unsigned i = 0; i < nofNodes; ++i) {
+    for (unsigned j = i + 1; j < nofNodes; ++j) {
+      if (coin(generator)) {
+        edges.emplace_back(i, j);
+      }
+    }
+  }
+  return edges;
+}
+
+/**
+ * @brief Graph and upper bound of a parameterized test.
+ */
+struct GraphTestRow {
+  EdgeList edges;
+  unsigned nofNodes;
+  size_t upperBound;
+};
+
+/**
+ * @brief Rows shared by the tests comparing an enumeration against runConsens.
+ *
+ * Every graph family once with and once without an upper bound, and the degenerate cases
+ * of graphs without edges or nodes and of the upper bounds 0 and 1.
+ */
+inline std::vector<GraphTestRow> getGraphTestRows()
+{
+  return {
+    GraphTestRow{getPathEdges(10), 10, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getCycleEdges(11), 11, 4},
+    GraphTestRow{getCliqueEdges(9), 9, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getCliqueEdges(9), 9, 3},
+    GraphTestRow{getGridEdges(3, 4), 12, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getGridEdges(6, 6), 36, 5},
+    GraphTestRow{getRandomTreeEdges(25, 3), 25, 8},
+    GraphTestRow{getRandomEdges(13, 0.3, 4), 13, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getRandomEdges(40, 0.1, 5), 40, 5},
+    GraphTestRow{EdgeList(), 5, std::numeric_limits<size_t>::max()},
+    GraphTestRow{EdgeList(), 0, std::numeric_limits<size_t>::max()},
+    GraphTestRow{getPathEdges(6), 6, 0},
+    GraphTestRow{getGridEdges(3, 3), 9, 1}
+  };
+}
@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/TopK.hpp"
+
+#include "TestGraphs.hpp"
+
+struct WeightScore {
+  int operator()(const std::vector<unsigned>& subgraph) const
+  {
+    ++*calls;
+    int score = 0;
+    for (unsigned node : subgraph) {
+      score += weights->at(node);
+    }
+    return score;
+  }
+
+  const std::vector<int>* weights;
+  size_t* calls;
+};
+
+/**
+ * The score of the subgraph plus all positive weights of the remaining nodes.
+ */
+struct WeightBound {
+  int operator()(const std::vector<unsigned>& current, const std::vector<unsigned>& candidates) const
+  {
+    int bound = 0;
+    for (unsigned node = 0; node < weights->size(); ++node) {
+      if (std::binary_search(current.begin(), current.end(), node)) {
+        bound += weights->at(node);
+      }
+      else {
+        bound += std::max(weights->at(node), 0);
+      }
+    }
+    return bound;
+  }
+
+  const std::vector<int>* weights;
+};
+
+struct EvenSizeFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    return subgraph.size() % 2 == 0;
+  }
+};
+
+std::vector<int> getRandomWeights(unsigned nofNodes, unsigned seed)
+{
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<int> distribution(-10, 4);
+  std::vector<int> weights(nofNodes);
+  for (int& weight : weights) {
+    weight = distribution(generator);
+  }
+  return weights;
+}
+
+struct TopKTestRow {
+  EdgeList edges;
+  unsigned nofNodes;
+  size_t upperBound;
+  size_t k;
+  unsigned seed;
+};
+
+class TopKTest : public ::testing::TestWithParam<TopKTestRow> {};
+
+template<typename Graph, typename FilterFunc>
+void checkTopK(const Graph& graph, const TopKTestRow& test_params, const std::vector<int>& weights,
+               const FilterFunc& filter)
+{
+  size_t calls = 0;
+  WeightScore score{&weights, &calls};
+  WeightBound bound{&weights};
+
+  std::vector<std::vector<unsigned>> expected = ConsensLib::runConsens(graph, test_params.upperBound, filter);
+  std::stable_sort(expected.begin(), expected.end(), [&score](const std::vector<unsigned>& s1,
+                                                              const std::vector<unsigned>& s2) {
+    return score(s1) > score(s2);
+  });
+  expected.resize(std::min(expected.size(), test_params.k));
+
+  calls = 0;
+  std::vector<ConsensLib::ScoredSubgraph<unsigned, int>> result
+      = ConsensLib::runConsensTopK(graph, test_params.k, score, bound, test_params.upperBound, filter);
+  ASSERT_EQ(result.size(), expected.size());
+  for (size_t pos = 0; pos < result.size(); ++pos) {
+    EXPECT_EQ(result.at(pos).subgraph, expected.at(pos));
+    EXPECT_EQ(result.at(pos).score, score(expected.at(pos)));
+  }
+}
+
+TEST_P(TopKTest, TestTopKEqualsSortedEnumeration) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+  std::vector<int> weights = getRandomWeights(test_params.nofNodes, test_params.seed);
+
+  checkTopK(sorted, test_params, weights, ConsensLib::NoFilter());
+  checkTopK(unsorted, test_params, weights, ConsensLib::NoFilter());
+  checkTopK(sorted, test_params, weights, EvenSizeFilter());
+}
+
+TEST(TopKPruningTest, TestBoundPrunesRecursion) {
+
+  SortedTestGraph graph(20, getGridEdges(4, 5));
+  std::vector<int> weights = getRandomWeights(20, 11);
+  size_t calls = 0;
+  WeightScore score{&weights, &calls};
+
+  size_t nofSubgraphs = ConsensLib::runConsens(graph).size();
+  ConsensLib::runConsensTopK(graph, 10, score, WeightBound{&weights});
+  EXPECT_LT(calls * 10, nofSubgraphs);
+}
+
+INSTANTIATE_TEST_SUITE_P(TopKTester, TopKTest, ::testing::Values(
+    TopKTestRow{getPathEdges(8), 8, std::numeric_limits<size_t>::max(), 3, 1},
+    TopKTestRow{getCycleEdges(9), 9, 4, 5, 2},
+    TopKTestRow{getGridEdges(3, 4), 12, std::numeric_limits<size_t>::max(), 10, 3},
+    TopKTestRow{getRandomEdges(14, 0.3, 4), 14, std::numeric_limits<size_t>::max(), 1, 4},
+    TopKTestRow{getRandomEdges(14, 0.3, 4), 14, 6, 25, 5},
+    TopKTestRow{getCliqueEdges(7), 7, std::numeric_limits<size_t>::max(), 200, 6},
+    TopKTestRow{getCliqueEdges(7), 7, std::numeric_limits<size_t>::max(), 0, 7}
+));
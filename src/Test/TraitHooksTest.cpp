@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ConsensLib/Consens.hpp"
+#include "ConsensLib/CsrGraph.hpp"
+#include "ConsensLib/GraphQueries.hpp"
+#include "ConsensLib/MappedCsrGraph.hpp"
+
+#include "CheckSubgraphs.hpp"
+#include "TestGraphs.hpp"
+
+/**
+ * Test graph whose traits provide all optional hooks. The index reverses the order of the nodes,
+ * so it differs from the order of every tested compare function.
+ */
+template<bool sorted>
+struct HookedTestGraph : public TestGraph<sorted> {
+
+  HookedTestGraph(size_t nofNodes, const std::vector<std::pair<unsigned, unsigned>>& edges)
+    : TestGraph<sorted>(nofNodes, edges) {}
+};
+
+namespace ConsensLib {
+
+template<bool sorted>
+struct GraphTraits<HookedTestGraph<sorted>> : public GraphTraits<TestGraph<sorted>> {
+  using Node = unsigned;
+
+  static size_t degree(
+      const Node& node,
+      const HookedTestGraph<sorted>& graph)
+  {
+    return graph.adjacency.at(node).size();
+  }
+
+  static bool isAdjacent(
+      const Node& n1,
+      const Node& n2,
+      const HookedTestGraph<sorted>& graph)
+  {
+    const std::vector<unsigned>& neighbors = graph.adjacency.at(n1);
+    return std::find(neighbors.begin(), neighbors.end(), n2) != neighbors.end();
+  }
+
+  static size_t index(
+      const Node& node,
+      const HookedTestGraph<sorted>& graph)
+  {
+    return graph.nodes.size() - 1 - node;
+  }
+
+  static size_t nodeCount(const HookedTestGraph<sorted>& graph)
+  {
+    return graph.nodes.size();
+  }
+
+  static size_t maxDegree(const HookedTestGraph<sorted>& graph)
+  {
+    size_t maxDegree = 0;
+    for (const std::vector<unsigned>& neighbors : graph.adjacency) {
+      maxDegree = std::max(maxDegree, neighbors.size());
+    }
+    return maxDegree;
+  }
+};
+}
+
+static_assert(ConsensLib::Intern::HasIndexHook<ConsensLib::CsrGraph<uint32_t>>::value, "CsrGraph provides index");
+static_assert(ConsensLib::Intern::HasMaxDegreeHook<ConsensLib::CsrGraph<uint16_t>>::value, "CsrGraph provides maxDegree");
+static_assert(ConsensLib::Intern::HasIsAdjacentHook<ConsensLib::MappedCsrGraph>::value, "MappedCsrGraph provides isAdjacent");
+static_assert(!ConsensLib::Intern::HasMaxDegreeHook<ConsensLib::MappedCsrGraph>::value, "MappedCsrGraph has no maxDegree");
+static_assert(!ConsensLib::Intern::HasIndexHook<SortedTestGraph>::value, "TestGraph has no hooks");
+static_assert(!ConsensLib::Intern::HasDegreeHook<UnsortedTestGraph>::value, "TestGraph has no hooks");
+static_assert(ConsensLib::Intern::HasDegreeHook<HookedTestGraph<true>>::value, "HookedTestGraph provides degree");
+
+/**
+ * Records all events as a sequence of numbers and prunes subgraphs of three nodes with an even sum.
+ */
+struct EventRecorder : public ConsensLib::EnumerationVisitor
+{
+  void push(unsigned node)
+  {
+    events.push_back(node);
+  }
+
+  void pop(unsigned node)
+  {
+    events.push_back(1000 + node);
+  }
+
+  void emit(const std::vector<unsigned>& subgraph)
+  {
+    events.push_back(2000);
+    events.insert(events.end(), subgraph.begin(), subgraph.end());
+  }
+
+  bool expand(const std::vector<unsigned>& current, const std::vector<unsigned>& candidates)
+  {
+    events.push_back(3000 + candidates.size());
+    return current.size() != 3 || std::accumulate(current.begin(), current.end(), 0u) % 2 == 1;
+  }
+
+  std::vector<size_t> events;
+};
+
+struct OddSumFilter {
+  bool operator()(const std::vector<unsigned>& subgraph) const
+  {
+    return std::accumulate(subgraph.begin(), subgraph.end(), 0u) % 2 == 1;
+  }
+};
+
+class TraitHooksTest : public ::testing::TestWithParam<GraphTestRow> {};
+
+TEST_P(TraitHooksTest, TestHooksKeepEvents) {
+
+  auto test_params = GetParam();
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+  HookedTestGraph<true> hookedSorted(test_params.nofNodes, test_params.edges);
+  HookedTestGraph<false> hookedUnsorted(test_params.nofNodes, test_params.edges);
+
+  EventRecorder expected;
+  ConsensLib::runConsensVisitor(sorted, expected, test_params.upperBound, OddSumFilter());
+  EventRecorder result;
+  ConsensLib::runConsensVisitor(hookedSorted, result, test_params.upperBound, OddSumFilter());
+  EXPECT_EQ(result.events, expected.events);
+
+  EventRecorder expectedUnsorted;
+  ConsensLib::runConsensVisitor(unsorted, expectedUnsorted, test_params.upperBound);
+  EventRecorder resultUnsorted;
+  ConsensLib::runConsensVisitor(hookedUnsorted, resultUnsorted, test_params.upperBound);
+  EXPECT_EQ(resultUnsorted.events, expectedUnsorted.events);
+
+  std::vector<std::vector<unsigned>> reversed = ConsensLib::runConsens(
+      hookedUnsorted, test_params.upperBound, ConsensLib::NoFilter(), std::greater<unsigned>());
+  checkValidity(reversed, hookedUnsorted, test_params.upperBound, ConsensLib::NoFilter(), std::greater<unsigned>());
+  EXPECT_EQ(reversed, ConsensLib::runConsens(unsorted, test_params.upperBound,
+                                             ConsensLib::NoFilter(), std::greater<unsigned>()));
+
+  std::vector<std::pair<uint32_t, uint32_t>> csrEdges(test_params.edges.begin(), test_params.edges.end());
+  ConsensLib::CsrGraph<uint32_t> csr(test_params.nofNodes, csrEdges);
+  std::vector<std::vector<uint32_t>> csrResult = ConsensLib::runConsens(csr, test_params.upperBound);
+  std::vector<std::vector<unsigned>> expectedResult = ConsensLib::runConsens(sorted, test_params.upperBound);
+  EXPECT_EQ(std::vector<std::vector<unsigned>>(csrResult.begin(), csrResult.end()), expectedResult);
+}
+
+TEST_P(TraitHooksTest, TestQueriesEqualFallback) {
+
+  auto test_params = GetParam();
+  UnsortedTestGraph unsorted(test_params.nofNodes, test_params.edges);
+  SortedTestGraph sorted(test_params.nofNodes, test_params.edges);
+  HookedTestGraph<false> hooked(test_params.nofNodes, test_params.edges);
+  std::vector<std::pair<uint32_t, uint32_t>> csrEdges(test_params.edges.begin(), test_params.edges.end());
+  ConsensLib::CsrGraph<uint32_t> csr(test_params.nofNodes, csrEdges);
+
+  EXPECT_EQ(ConsensLib::getMaxDegree(hooked), ConsensLib::getMaxDegree(unsorted));
+  EXPECT_EQ(ConsensLib::getMaxDegree(csr), ConsensLib::getMaxDegree(unsorted));
+  for (unsigned n1 = 0; n1 < test_params.nofNodes; ++n1) {
+    EXPECT_EQ(ConsensLib::getDegree(n1, hooked), ConsensLib::getDegree(n1, unsorted));
+    EXPECT_EQ(ConsensLib::getDegree(n1, csr), ConsensLib::getDegree(n1, unsorted));
+    for (unsigned n2 = 0; n2 < test_params.nofNodes; ++n2) {
+      bool adjacent = ConsensLib::areAdjacent(n1, n2, unsorted);
+      EXPECT_EQ(ConsensLib::areAdjacent(n1, n2, sorted), adjacent);
+      EXPECT_EQ(ConsensLib::areAdjacent(n1, n2, hooked), adjacent);
+      EXPECT_EQ(ConsensLib::areAdjacent(n1, n2, csr), adjacent);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(TraitHooksTester, TraitHooksTest, ::testing::ValuesIn(getGraphTestRows()));
@@ -0,0 +1,30 @@
+#include <fstream>
+#include <iostream>
+
+#include "ConsensLib/MappedCsrGraph.hpp"
+
+int main(int argc, char** argv)
+{
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <edge list> <graph file>\n\n"
+                 "Converts a text edge list with one edge 'u v' per line into the memory-mappable\n"
+                 "graph file read by ConsensLib::MappedCsrGraph.\n";
+    return 1;
+  }
+  std::ifstream input(argv[1]);
+  if (!input) {
+    std::cerr << "Cannot open " << argv[1] << "\n";
+    return 1;
+  }
+  if (!ConsensLib::convertEdgeListToCsrFile(input, argv[2])) {
+    std::cerr << "Cannot convert " << argv[1] << " to " << argv[2] << "\n";
+    return 1;
+  }
+  ConsensLib::MappedCsrGraph graph(argv[2]);
+  if (!graph.validate()) {
+    std::cerr << "Cannot read back " << argv[2] << "\n";
+    return 1;
+  }
+  std::cout << "Wrote " << graph.nofNodes() << " nodes and " << graph.nofEdges() << " edges to " << argv[2] << "\n";
+  return 0;
+}